@@ -30,13 +30,13 @@ int solve_case(std::string_view directions) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day01.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(-1, solve_case<false>(example));
-  const auto input = parse("day01.input");
+  const auto input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(280, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(5, solve_case<true>(example));
   AOC_EXPECT_RESULT(1797, solve_case<true>(input));
 
@@ -42,13 +42,13 @@ int solve_case2(const boxes_t& boxes) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day02.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day02.example"));
   AOC_EXPECT_RESULT((58 + 43), solve_case1(example));
-  const auto input = parse("day02.input");
+  const auto input = AOC_TIMED_PARSE(parse("day02.input"));
   AOC_EXPECT_RESULT(1606483, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT((34 + 14), solve_case2(example));
   AOC_EXPECT_RESULT(3842356, solve_case2(input));
 
@@ -38,13 +38,13 @@ int solve_case(std::string_view directions) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day03.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day03.example"));
   AOC_EXPECT_RESULT(4, solve_case<1>(example));
-  const auto input = parse("day03.input");
+  const auto input = AOC_TIMED_PARSE(parse("day03.input"));
   AOC_EXPECT_RESULT(2565, solve_case<1>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3, solve_case<2>(example));
   AOC_EXPECT_RESULT(2639, solve_case<2>(input));
 
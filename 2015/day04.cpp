@@ -23,6 +23,7 @@ fn solve_case(str key) -> u32 {
   auto result = std::atomic<u32>{std::numeric_limits<u32>::max()};
 
   auto search = [&, key](u32 start) {
+    AOC_TRACE_SCOPE("search", start);
     char buf[64];
     std::memcpy(buf, key.data(), key.size());
     for (auto n = start; n < result.load(std::memory_order_relaxed);
@@ -45,6 +46,8 @@ fn solve_case(str key) -> u32 {
   };
 
   {
+    // Outlives the threads, so it covers joining them as well
+    AOC_TRACE_SCOPE("spawn and join");
     auto threads = std::vector<std::jthread>{};
     threads.reserve(num_threads);
     for (u32 i = 0; i < num_threads; ++i) {
@@ -56,14 +59,14 @@ fn solve_case(str key) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day04.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day04.example"));
   AOC_EXPECT_RESULT(609043, solve_case<false>(example));
   AOC_EXPECT_RESULT(1048970, solve_case<false>("pqrstuv"));
-  let input = parse("day04.input");
+  let input = AOC_TIMED_PARSE(parse("day04.input"));
   AOC_EXPECT_RESULT(254575, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(6742839, solve_case<true>(example));
   AOC_EXPECT_RESULT(5714438, solve_case<true>("pqrstuv"));
   AOC_EXPECT_RESULT(1038736, solve_case<true>(input));
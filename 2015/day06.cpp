@@ -49,7 +49,8 @@ using instructions_t = std::vector<instruction_t>;
 instructions_t parse(const std::string& filename) {
   using boundaries_t = std::array<std::string_view, 2>;
   auto instructions = instructions_t{};
-  for (std::string_view line : aoc::views::read_lines(filename)) {
+  const auto input = aoc::mapped_file{filename};
+  for (std::string_view line : input.lines()) {
     op_t op;
     boundaries_t boundaries;
     if (line.starts_with(turn_on)) {
@@ -105,13 +106,13 @@ unsigned solve_case(const instructions_t& instructions) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day06.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day06.example"));
   AOC_EXPECT_RESULT(998996, solve_case<false>(example));
-  const auto input = parse("day06.input");
+  const auto input = AOC_TIMED_PARSE(parse("day06.input"));
   AOC_EXPECT_RESULT(569999, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1001996, solve_case<true>(example));
   AOC_EXPECT_RESULT(17836115, solve_case<true>(input));
 
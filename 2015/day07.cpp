@@ -175,13 +175,13 @@ strict_signal_t solve_case(circuit_t circuit) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day07.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day07.example"));
   AOC_EXPECT_RESULT(114, solve_case<false>(example));
-  const auto input = parse("day07.input");
+  const auto input = AOC_TIMED_PARSE(parse("day07.input"));
   AOC_EXPECT_RESULT(16076, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(28, solve_case<true>(example));
   AOC_EXPECT_RESULT(2797, solve_case<true>(input));
 
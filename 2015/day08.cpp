@@ -65,13 +65,13 @@ int solve_case2(const lines_t& lines) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day08.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day08.example"));
   AOC_EXPECT_RESULT(12, solve_case1(example));
-  const auto input = parse("day08.input");
+  const auto input = AOC_TIMED_PARSE(parse("day08.input"));
   AOC_EXPECT_RESULT(1333, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(19, solve_case2(example));
   AOC_EXPECT_RESULT(2046, solve_case2(input));
 
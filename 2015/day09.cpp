@@ -75,13 +75,13 @@ int solve_case(const connections_t& connections) {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day09.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day09.example"));
   AOC_EXPECT_RESULT(605, solve_case<false>(example));
-  let input = parse("day09.input");
+  let input = AOC_TIMED_PARSE(parse("day09.input"));
   AOC_EXPECT_RESULT(141, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(982, solve_case<true>(example));
   AOC_EXPECT_RESULT(736, solve_case<true>(input));
 
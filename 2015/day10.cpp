@@ -42,13 +42,13 @@ int solve_case(Vec<u32> const& digits) {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day10.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day10.example"));
   AOC_EXPECT_RESULT(237746, solve_case<40>(example));
-  let input = parse("day10.input");
+  let input = AOC_TIMED_PARSE(parse("day10.input"));
   AOC_EXPECT_RESULT(360154, solve_case<40>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3369156, solve_case<50>(example));
   AOC_EXPECT_RESULT(5103798, solve_case<50>(input));
 
@@ -176,15 +176,15 @@ String solve_case(str const& password) {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day11.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day11.example"));
   const auto example_solved = solve_case(example);
   AOC_EXPECT_RESULT("ghjaabcc", example_solved);
-  let input = parse("day11.input");
+  let input = AOC_TIMED_PARSE(parse("day11.input"));
   const auto input_solved = solve_case(input);
   AOC_EXPECT_RESULT("hxbxxyzz", input_solved);
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT("ghjbbcdd", solve_case(example_solved));
   AOC_EXPECT_RESULT("hxcaabcc", solve_case(input_solved));
 
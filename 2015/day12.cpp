@@ -115,13 +115,13 @@ fn solve_case(str line) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day12.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day12.example"));
   AOC_EXPECT_RESULT(6, solve_case<false>(example));
-  let input = parse("day12.input");
+  let input = AOC_TIMED_PARSE(parse("day12.input"));
   AOC_EXPECT_RESULT(156366, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(4, solve_case<true>(example));
   AOC_EXPECT_RESULT(96852, solve_case<true>(input));
 
@@ -88,13 +88,13 @@ fn solve_case2(connections_t const& connections) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day13.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day13.example"));
   AOC_EXPECT_RESULT(330, solve_case1(example));
-  let input = parse("day13.input");
+  let input = AOC_TIMED_PARSE(parse("day13.input"));
   AOC_EXPECT_RESULT(664, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(286, solve_case2(example));
   AOC_EXPECT_RESULT(640, solve_case2(input));
 
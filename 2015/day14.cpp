@@ -71,13 +71,13 @@ fn solve_case2(Vec<Reindeer> const& flock) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day14.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day14.example"));
   AOC_EXPECT_RESULT(1120, solve_case1<1000>(example));
-  let input = parse("day14.input");
+  let input = AOC_TIMED_PARSE(parse("day14.input"));
   AOC_EXPECT_RESULT(2660, solve_case1<2503>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(689, solve_case2<1000>(example));
   AOC_EXPECT_RESULT(1256, solve_case2<2503>(input));
 
@@ -80,13 +80,13 @@ fn solve_case(Vec<Ingredient> const& ingredients) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day15.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day15.example"));
   AOC_EXPECT_RESULT(62842880, solve_case<false>(example));
-  let input = parse("day15.input");
+  let input = AOC_TIMED_PARSE(parse("day15.input"));
   AOC_EXPECT_RESULT(21367368, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(57600000, solve_case<true>(example));
   AOC_EXPECT_RESULT(1766400, solve_case<true>(input));
 
@@ -66,11 +66,11 @@ fn solve_case(Vec<Sue> const& sues) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let input = parse("day16.input");
+  AOC_PART(1);
+  let input = AOC_TIMED_PARSE(parse("day16.input"));
   AOC_EXPECT_RESULT(373, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(260, solve_case<true>(input));
 
   AOC_RETURN_CHECK_RESULT();
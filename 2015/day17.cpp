@@ -42,13 +42,13 @@ fn solve_case(Vec<u32> const& sizes) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day17.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day17.example"));
   AOC_EXPECT_RESULT(4, (solve_case<25, false>(example)));
-  let input = parse("day17.input");
+  let input = AOC_TIMED_PARSE(parse("day17.input"));
   AOC_EXPECT_RESULT(1304, (solve_case<150, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3, (solve_case<25, true>(example)));
   AOC_EXPECT_RESULT(18, (solve_case<150, true>(input)));
 
@@ -61,13 +61,13 @@ fn solve_case(grid_t current_lights) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day18.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day18.example"));
   AOC_EXPECT_RESULT(4, (solve_case<4, false>(example)));
-  let input = parse("day18.input");
+  let input = AOC_TIMED_PARSE(parse("day18.input"));
   AOC_EXPECT_RESULT(1061, (solve_case<100, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(17, (solve_case<5, true>(example)));
   AOC_EXPECT_RESULT(1006, (solve_case<100, true>(input)));
 
@@ -49,13 +49,13 @@ fn solve_case1(auto&& parse_input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day19.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day19.example"));
   AOC_EXPECT_RESULT(4, solve_case1(example));
-  let input = parse("day19.input");
+  let input = AOC_TIMED_PARSE(parse("day19.input"));
   AOC_EXPECT_RESULT(576, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(3, solve_case2(example));
   // AOC_EXPECT_RESULT(1257, solve_case2(input));
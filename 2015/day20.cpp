@@ -28,11 +28,11 @@ fn solve_case() -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
+  AOC_PART(1);
   AOC_EXPECT_RESULT(8, (solve_case<150, false>()));
   AOC_EXPECT_RESULT(831600, (solve_case<36'000'000, false>()));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(8, (solve_case<150, true>()));
   AOC_EXPECT_RESULT(884520, (solve_case<36'000'000, true>()));
 
@@ -129,13 +129,13 @@ fn solve_case(Entity const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day21.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day21.example"));
   AOC_EXPECT_RESULT(65, (solve_case<8, false>(example)));
-  let input = parse("day21.input");
+  let input = AOC_TIMED_PARSE(parse("day21.input"));
   AOC_EXPECT_RESULT(111, (solve_case<100, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(188, (solve_case<8, true>(example)));
   AOC_EXPECT_RESULT(188, (solve_case<100, true>(input)));
 
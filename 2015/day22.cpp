@@ -282,15 +282,15 @@ fn solve_case(Boss const& boss_orig) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day22.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day22.example"));
   AOC_EXPECT_RESULT(226, (solve_case<false, false>(example)));
-  let example2 = parse("day22.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day22.example2"));
   AOC_EXPECT_RESULT(641, (solve_case<false, false>(example2)));
-  let input = parse("day22.input");
+  let input = AOC_TIMED_PARSE(parse("day22.input"));
   AOC_EXPECT_RESULT(953, (solve_case<true, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(226, (solve_case<false, true>(example)));
   AOC_EXPECT_RESULT(588, (solve_case<false, true>(example2)));
   AOC_EXPECT_RESULT(1289, (solve_case<true, true>(input)));
@@ -87,13 +87,13 @@ fn solve_case(Instructions const& instructions) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day23.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day23.example"));
   AOC_EXPECT_RESULT(2, solve_case<0>(example));
-  let input = parse("day23.input");
+  let input = AOC_TIMED_PARSE(parse("day23.input"));
   AOC_EXPECT_RESULT(255, solve_case<0>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2, solve_case<1>(example));
   AOC_EXPECT_RESULT(334, solve_case<1>(input));
 
@@ -68,13 +68,13 @@ fn solve_case(std::span<const u32> packages) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day24.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day24.example"));
   AOC_EXPECT_RESULT(99, solve_case<3>(example));
-  let input = parse("day24.input");
+  let input = AOC_TIMED_PARSE(parse("day24.input"));
   AOC_EXPECT_RESULT(10723906903, solve_case<3>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(44, solve_case<4>(example));
   AOC_EXPECT_RESULT(74850409, solve_case<4>(input));
 
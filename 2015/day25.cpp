@@ -54,10 +54,10 @@ fn solve_case(const coords_t coords) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day25.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day25.example"));
   AOC_EXPECT_RESULT(12231762, solve_case(example));
-  let input = parse("day25.input");
+  let input = AOC_TIMED_PARSE(parse("day25.input"));
   AOC_EXPECT_RESULT(2650453, solve_case(input));
 
   AOC_RETURN_CHECK_RESULT();
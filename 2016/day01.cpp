@@ -66,15 +66,15 @@ fn solve_case(Vec<Instruction> const& instructions) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day01.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(12, solve_case<false>(example));
-  let example2 = parse("day01.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day01.example2"));
   AOC_EXPECT_RESULT(8, solve_case<false>(example2));
-  let input = parse("day01.input");
+  let input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(279, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(12, solve_case<true>(example));
   AOC_EXPECT_RESULT(4, solve_case<true>(example2));
   AOC_EXPECT_RESULT(163, solve_case<true>(input));
@@ -29,13 +29,13 @@ fn solve_case2(std::span<const u32> depths) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day01.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(7, solve_case1(example));
-  let input = parse("day01.input");
+  let input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(1228, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(5, solve_case2(example));
   AOC_EXPECT_RESULT(1257, solve_case2(input));
 
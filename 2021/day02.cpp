@@ -68,13 +68,13 @@ int solve_part2(const commands_t& commands) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day02.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day02.example"));
   AOC_EXPECT_RESULT(150, solve_part1(example));
-  const auto input = parse("day02.input");
+  const auto input = AOC_TIMED_PARSE(parse("day02.input"));
   AOC_EXPECT_RESULT(2120749, solve_part1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(900, solve_part2(example));
   AOC_EXPECT_RESULT(2138382217, solve_part2(input));
 
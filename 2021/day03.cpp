@@ -77,13 +77,13 @@ fn solve_case2(std::span<const Bitset> report) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day03.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day03.example"));
   AOC_EXPECT_RESULT(198, solve_case1(example));
-  let input = parse("day03.input");
+  let input = AOC_TIMED_PARSE(parse("day03.input"));
   AOC_EXPECT_RESULT(4138664, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(230, solve_case2(example));
   AOC_EXPECT_RESULT(4273224, solve_case2(input));
 
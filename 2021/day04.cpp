@@ -180,13 +180,13 @@ end_rounds:
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day04.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day04.example"));
   AOC_EXPECT_RESULT(4512, solve_case(example, 1));
-  const auto input = parse("day04.input");
+  const auto input = AOC_TIMED_PARSE(parse("day04.input"));
   AOC_EXPECT_RESULT(64084, solve_case(input, 1));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1924, solve_case(example, -1));
   AOC_EXPECT_RESULT(12833, solve_case(input, -1));
 
@@ -54,13 +54,13 @@ fn solve_case(let& segment_pair) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day05.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day05.example"));
   AOC_EXPECT_RESULT(5, solve_case<false>(example));
-  let input = parse("day05.input");
+  let input = AOC_TIMED_PARSE(parse("day05.input"));
   AOC_EXPECT_RESULT(6461, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(12, solve_case<true>(example));
   AOC_EXPECT_RESULT(18065, solve_case<true>(input));
 
@@ -64,14 +64,14 @@ int_t solve_case(const std::vector<int>& fish_stages) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day06.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day06.example"));
   AOC_EXPECT_RESULT(26, (solve_case<18, 7, 2>(example)));
   AOC_EXPECT_RESULT(5934, (solve_case<80, 7, 2>(example)));
-  const auto input = parse("day06.input");
+  const auto input = AOC_TIMED_PARSE(parse("day06.input"));
   AOC_EXPECT_RESULT(371379, (solve_case<80, 7, 2>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(26984457539, (solve_case<256, 7, 2>(example)));
   AOC_EXPECT_RESULT(1674303997472, (solve_case<256, 7, 2>(input)));
 
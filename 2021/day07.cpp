@@ -127,13 +127,13 @@ int_t solve_case(crabs_t const& crabs) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day07.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day07.example"));
   AOC_EXPECT_RESULT(37, (solve_case<false>(example)));
-  const auto input = parse("day07.input");
+  const auto input = AOC_TIMED_PARSE(parse("day07.input"));
   AOC_EXPECT_RESULT(355592, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(168, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(101618069, (solve_case<true>(input)));
 
@@ -59,15 +59,15 @@ fn solve_case1(Input const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day08.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day08.example"));
   AOC_EXPECT_RESULT(0, solve_case1(example));
-  let example2 = parse("day08.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day08.example2"));
   AOC_EXPECT_RESULT(26, solve_case1(example2));
-  let input = parse("day08.input");
+  let input = AOC_TIMED_PARSE(parse("day08.input"));
   AOC_EXPECT_RESULT(440, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
 
   AOC_RETURN_CHECK_RESULT();
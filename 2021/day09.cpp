@@ -78,13 +78,13 @@ int solve_case(const heightmap_t& heightmap) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day09.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day09.example"));
   AOC_EXPECT_RESULT(15, solve_case<false>(example));
-  const auto input = parse("day09.input");
+  const auto input = AOC_TIMED_PARSE(parse("day09.input"));
   AOC_EXPECT_RESULT(580, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1134, solve_case<true>(example));
   AOC_EXPECT_RESULT(856716, solve_case<true>(input));
 
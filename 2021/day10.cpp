@@ -75,13 +75,13 @@ int_t solve_case(const std::vector<std::string>& navigation_lines) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day10.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day10.example"));
   AOC_EXPECT_RESULT(26397, solve_case<false>(example));
-  const auto input = parse("day10.input");
+  const auto input = AOC_TIMED_PARSE(parse("day10.input"));
   AOC_EXPECT_RESULT(319233, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(288957, solve_case<true>(example));
   AOC_EXPECT_RESULT(1118976874, solve_case<true>(input));
 
@@ -66,15 +66,15 @@ fn solve_case(EnergyLevels const& energy_levels) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day11.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day11.example"));
   AOC_EXPECT_RESULT(9, solve_case<2>(example));
-  let example2 = parse("day11.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day11.example2"));
   AOC_EXPECT_RESULT(1656, solve_case<100>(example2));
-  let input = parse("day11.input");
+  let input = AOC_TIMED_PARSE(parse("day11.input"));
   AOC_EXPECT_RESULT(1694, solve_case<100>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(6, solve_case<usize_max>(example));
   AOC_EXPECT_RESULT(195, solve_case<usize_max>(example2));
   AOC_EXPECT_RESULT(346, solve_case<usize_max>(input));
@@ -93,18 +93,18 @@ fn solve_case(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
+  AOC_PART(1);
 
-  let example1 = parse("day12.example");
+  let example1 = AOC_TIMED_PARSE(parse("day12.example"));
   AOC_EXPECT_RESULT(10, (solve_case<false>(example1)));
-  let example2 = parse("day12.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day12.example2"));
   AOC_EXPECT_RESULT(19, (solve_case<false>(example2)));
-  let example3 = parse("day12.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day12.example3"));
   AOC_EXPECT_RESULT(226, (solve_case<false>(example3)));
-  let input = parse("day12.input");
+  let input = AOC_TIMED_PARSE(parse("day12.input"));
   AOC_EXPECT_RESULT(4104, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(36, (solve_case<true>(example1)));
   AOC_EXPECT_RESULT(103, (solve_case<true>(example2)));
   AOC_EXPECT_RESULT(3509, (solve_case<true>(example3)));
@@ -88,13 +88,13 @@ fn solve_case2(Input const& input) -> Dots {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day13.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day13.example"));
   AOC_EXPECT_RESULT(17, solve_case1(example));
-  let input = parse("day13.input");
+  let input = AOC_TIMED_PARSE(parse("day13.input"));
   AOC_EXPECT_RESULT(785, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT("#####\n"
                     "#...#\n"
                     "#...#\n"
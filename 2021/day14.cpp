@@ -78,13 +78,13 @@ fn solve_case(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day14.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day14.example"));
   AOC_EXPECT_RESULT(1588, solve_case<10>(example));
-  let input = parse("day14.input");
+  let input = AOC_TIMED_PARSE(parse("day14.input"));
   AOC_EXPECT_RESULT(2703, solve_case<10>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2188189693529, solve_case<40>(example));
   AOC_EXPECT_RESULT(2984946368465, solve_case<40>(input));
 
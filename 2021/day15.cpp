@@ -72,13 +72,13 @@ fn solve_case2(Input const& grid) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day15.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day15.example"));
   AOC_EXPECT_RESULT(40, solve_case1(example));
-  let input = parse("day15.input");
+  let input = AOC_TIMED_PARSE(parse("day15.input"));
   AOC_EXPECT_RESULT(592, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(315, solve_case2(example));
   AOC_EXPECT_RESULT(2897, solve_case2(input));
 
@@ -147,19 +147,19 @@ fn solve_case2(str hex_packet) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
+  AOC_PART(1);
   AOC_EXPECT_RESULT(6u, solve_case1("D2FE28"));
   AOC_EXPECT_RESULT(9u, solve_case1("38006F45291200"));
   AOC_EXPECT_RESULT(16u, solve_case1("8A004A801A8002F478"));
   AOC_EXPECT_RESULT(12u, solve_case1("620080001611562C8802118E34"));
   AOC_EXPECT_RESULT(23u, solve_case1("C0015000016115A2E0802F182340"));
   AOC_EXPECT_RESULT(31u, solve_case1("A0016C880162017C3686B18A3D4780"));
-  let example = parse("day16.example");
+  let example = AOC_TIMED_PARSE(parse("day16.example"));
   AOC_EXPECT_RESULT(6u, solve_case1(example));
-  let input = parse("day16.input");
+  let input = AOC_TIMED_PARSE(parse("day16.input"));
   AOC_EXPECT_RESULT(925u, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3ull, solve_case2("C200B40A82"));
   AOC_EXPECT_RESULT(54ull, solve_case2("04005AC33890"));
   AOC_EXPECT_RESULT(7ull, solve_case2("880086C3E88112"));
@@ -72,13 +72,13 @@ fn solve_case2(Input const& rectangle) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day17.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day17.example"));
   AOC_EXPECT_RESULT(45, solve_case1(example));
-  const auto input = parse("day17.input");
+  const auto input = AOC_TIMED_PARSE(parse("day17.input"));
   AOC_EXPECT_RESULT(5565, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(112, solve_case2(example));
   AOC_EXPECT_RESULT(2118, solve_case2(input));
 
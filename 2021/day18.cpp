@@ -177,7 +177,7 @@ fn solve_case2(std::span<const SFN> numbers) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
+  AOC_PART(1);
   AOC_EXPECT_RESULT(143, magnitude(parse_sfn("[[1,2],[[3,4],5]]")));
   AOC_EXPECT_RESULT(1384,
                     magnitude(parse_sfn("[[[[0,7],4],[[7,8],[6,0]]],[8,1]]")));
@@ -188,12 +188,12 @@ int main() {
   AOC_EXPECT_RESULT(
       3488, magnitude(parse_sfn(
                 "[[[[8,7],[7,7]],[[8,6],[7,7]]],[[[0,7],[6,6]],[8,7]]]")));
-  let example = parse("day18.example");
+  let example = AOC_TIMED_PARSE(parse("day18.example"));
   AOC_EXPECT_RESULT(4140, solve_case1(example));
-  let input = parse("day18.input");
+  let input = AOC_TIMED_PARSE(parse("day18.input"));
   AOC_EXPECT_RESULT(4207, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3993, solve_case2(example));
   AOC_EXPECT_RESULT(4635, solve_case2(input));
 
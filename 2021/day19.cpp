@@ -196,13 +196,13 @@ fn solve_case2(std::span<Scanner const> scanners) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day19.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day19.example"));
   AOC_EXPECT_RESULT(79, solve_case1(example));
-  let input = parse("day19.input");
+  let input = AOC_TIMED_PARSE(parse("day19.input"));
   AOC_EXPECT_RESULT(372, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3621, solve_case2(example));
   AOC_EXPECT_RESULT(12241, solve_case2(input));
 
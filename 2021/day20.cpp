@@ -78,13 +78,13 @@ fn solve_case(Input const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day20.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day20.example"));
   AOC_EXPECT_RESULT(35, solve_case<2>(example));
-  let input = parse("day20.input");
+  let input = AOC_TIMED_PARSE(parse("day20.input"));
   AOC_EXPECT_RESULT(5249, solve_case<2>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3351, solve_case<50>(example));
   AOC_EXPECT_RESULT(15714, solve_case<50>(input));
 
@@ -134,13 +134,13 @@ fn solve_case2(Input positions) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day21.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day21.example"));
   AOC_EXPECT_RESULT(739785, solve_case1(example));
-  let input = parse("day21.input");
+  let input = AOC_TIMED_PARSE(parse("day21.input"));
   AOC_EXPECT_RESULT(805932, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(444356092776315ULL, solve_case2(example));
   AOC_EXPECT_RESULT(133029050096658ULL, solve_case2(input));
 
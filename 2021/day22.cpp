@@ -119,17 +119,17 @@ fn solve_case1(std::span<Cuboid const> steps) -> u64 {
 fn solve_case2(std::span<Cuboid const> steps) -> u64 { return reboot(steps); }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day22.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day22.example"));
   AOC_EXPECT_RESULT(39ULL, solve_case1(example));
-  let example2 = parse("day22.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day22.example2"));
   AOC_EXPECT_RESULT(590784ULL, solve_case1(example2));
-  let example3 = parse("day22.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day22.example3"));
   AOC_EXPECT_RESULT(474140ULL, solve_case1(example3));
-  let input = parse("day22.input");
+  let input = AOC_TIMED_PARSE(parse("day22.input"));
   AOC_EXPECT_RESULT(596989ULL, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(39ULL, solve_case2(example));
   AOC_EXPECT_RESULT(39769202357779ULL, solve_case2(example2));
   AOC_EXPECT_RESULT(2758514936282235ULL, solve_case2(example3));
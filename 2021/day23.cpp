@@ -36,9 +36,9 @@ struct Configuration {
   Hallway hallway;
   Rooms rooms;
   fn operator<=>(const Configuration&) const = default;
+
+  using aoc_hash = aoc::packed_hash;
 };
-template <>
-struct std::hash<Configuration> : aoc::packed_hash {};
 static_assert(aoc::hashable<Configuration>);
 
 fn get_cost(char c) -> u32 {
@@ -113,7 +113,8 @@ fn heuristic(Configuration const& config, usize room_size) -> i32 {
   return cost;
 }
 
-fn solve(Rooms const& rooms, usize room_size) -> u32 {
+fn solve(Rooms const& rooms, usize room_size,
+         aoc::search_stats* stats_out = nullptr) -> u32 {
   let start = Configuration{HALLWAY, rooms};
 
   auto end_rooms = Rooms{};
@@ -243,14 +244,19 @@ fn solve(Rooms const& rooms, usize room_size) -> u32 {
       },
       [&](Configuration const& config) {
         return heuristic(config, room_size);
-      });
+      },
+      aoc::no_predecessors<Configuration>, stats_out);
 
   return distances.find(end)->second;
 }
 
-fn solve_case1(Rooms const& rooms) -> u32 { return solve(rooms, 2); }
+fn solve_case1(Rooms const& rooms, aoc::search_stats* stats_out = nullptr)
+    -> u32 {
+  return solve(rooms, 2, stats_out);
+}
 
-fn solve_case2(Rooms const& rooms) -> u32 {
+fn solve_case2(Rooms const& rooms, aoc::search_stats* stats_out = nullptr)
+    -> u32 {
   //   #D#C#B#A#  -> slot 2
   //   #D#B#A#C#  -> slot 1
   constexpr let inserted_upper = std::array{'D', 'C', 'B', 'A'};
@@ -260,19 +266,23 @@ fn solve_case2(Rooms const& rooms) -> u32 {
     rooms4[i] = {rooms[i][0], inserted_lower[i], inserted_upper[i],
                  rooms[i][1]};
   }
-  return solve(rooms4, 4);
+  return solve(rooms4, 4, stats_out);
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day23.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day23.example"));
   AOC_EXPECT_RESULT(12521, solve_case1(example));
-  let input = parse("day23.input");
-  AOC_EXPECT_RESULT(14350, solve_case1(input));
+  let input = AOC_TIMED_PARSE(parse("day23.input"));
+  // How much heuristic prunes, and how far below the answer it starts
+  auto stats = aoc::search_stats{};
+  AOC_EXPECT_RESULT(14350, solve_case1(input, &stats));
+  std::println("{}", stats);
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(44169, solve_case2(example));
-  AOC_EXPECT_RESULT(49742, solve_case2(input));
+  AOC_EXPECT_RESULT(49742, solve_case2(input, &stats));
+  std::println("{}", stats);
 
   AOC_RETURN_CHECK_RESULT();
 }
@@ -352,12 +352,12 @@ int main() {
 
   auto valid_z_output = Option<ZOutputCache>{};
 
-  std::println("Part 1");
+  AOC_PART(1);
 
-  let input = parse("day24.input");
+  let input = AOC_TIMED_PARSE(parse("day24.input"));
   AOC_EXPECT_RESULT(99919765949498, solve_case<false>(input, valid_z_output));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(24913111616151, solve_case<true>(input, valid_z_output));
 
   AOC_RETURN_CHECK_RESULT();
@@ -62,13 +62,13 @@ fn solve_case1(Seafloor const& seafloor) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day25.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day25.example"));
   AOC_EXPECT_RESULT(58, solve_case1(example));
-  let input = parse("day25.input");
+  let input = AOC_TIMED_PARSE(parse("day25.input"));
   AOC_EXPECT_RESULT(329, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(XXX, solve_case2(example));
   // AOC_EXPECT_RESULT(XXX, solve_case2(input));
@@ -27,13 +27,13 @@ fn solve_case2(Vec<u32> elves) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day01.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(24000, solve_case1(example));
-  let input = parse("day01.input");
+  let input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(75622, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(45000, solve_case2(example));
   AOC_EXPECT_RESULT(213159, solve_case2(input));
 
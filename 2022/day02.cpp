@@ -92,13 +92,13 @@ fn solve_case2(std::span<const std::pair<char, char>> input) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day02.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day02.example"));
   AOC_EXPECT_RESULT(15, solve_case1(example));
-  let input = parse("day02.input");
+  let input = AOC_TIMED_PARSE(parse("day02.input"));
   AOC_EXPECT_RESULT(14375, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(12, solve_case2(example));
   AOC_EXPECT_RESULT(10274, solve_case2(input));
 
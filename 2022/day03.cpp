@@ -96,13 +96,13 @@ fn solve_case2(std::span<const String> input) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day03.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day03.example"));
   AOC_EXPECT_RESULT(157, solve_case1(example));
-  let input = parse("day03.input");
+  let input = AOC_TIMED_PARSE(parse("day03.input"));
   AOC_EXPECT_RESULT(7793, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(70, solve_case2(example));
   AOC_EXPECT_RESULT(2499, solve_case2(input));
 
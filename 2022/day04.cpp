@@ -44,13 +44,13 @@ fn solve_case(std::span<const std::pair<range, range>> input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day04.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day04.example"));
   AOC_EXPECT_RESULT(2, solve_case<false>(example));
-  let input = parse("day04.input");
+  let input = AOC_TIMED_PARSE(parse("day04.input"));
   AOC_EXPECT_RESULT(582, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(4, solve_case<true>(example));
   AOC_EXPECT_RESULT(893, solve_case<true>(input));
 
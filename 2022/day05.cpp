@@ -20,7 +20,9 @@ struct crate_move {
 using Stacks = aoc::static_vector<String, 9>;
 using Input = std::pair<Stacks, Vec<crate_move>>;
 
-auto parse(String const& filename) -> Input {
+auto parse(String const& filename,
+           usize block_size = aoc::chunked_reader::default_block_size)
+    -> Input {
   // There can't be more than 9 crates because that would break the parsing
   // Initially we don't know how many stacks we have,
   // and the parsing gets the crates in reverse order
@@ -28,9 +30,10 @@ auto parse(String const& filename) -> Input {
   int num_stacks = 0;
   Vec<crate_move> moves;
 
-  // Don't trim spaces, we need them in this example
-  for (std::string_view line :
-       aoc::views::read_lines(filename, aoc::keep_spaces{})) {
+  // Don't trim spaces, we need them in this example.
+  // Each line is done with before the next, one pass through the file.
+  auto reader = aoc::chunked_reader{filename, block_size};
+  for (std::string_view line : reader.lines(aoc::keep_spaces{})) {
     if (line.at(0) != 'm') {
       // First parse the crates
       if (line.at(1) != '1') {
@@ -105,13 +108,15 @@ fn solve_case(Input const& input) -> String {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day05.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day05.example"));
   AOC_EXPECT_RESULT("CMZ", solve_case<false>(example));
-  let input = parse("day05.input");
+  // The leading spaces of a line cut by the end of a block are kept
+  AOC_EXPECT_RESULT("CMZ", solve_case<false>(parse("day05.example", 3)));
+  let input = AOC_TIMED_PARSE(parse("day05.input"));
   AOC_EXPECT_RESULT("QGTHFZBHV", solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT("MCD", solve_case<true>(example));
   AOC_EXPECT_RESULT("MGDMPSZTM", solve_case<true>(input));
 
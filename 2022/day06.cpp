@@ -43,19 +43,19 @@ fn solve_case(Vec<String> const& lines) -> Vec<i32> {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day06.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day06.example"));
   let example4 = solve_case<4>(example);
   AOC_EXPECT_RESULT(7, example4[0]);
   AOC_EXPECT_RESULT(5, example4[1]);
   AOC_EXPECT_RESULT(6, example4[2]);
   AOC_EXPECT_RESULT(10, example4[3]);
   AOC_EXPECT_RESULT(11, example4[4]);
-  let input = parse("day06.input");
+  let input = AOC_TIMED_PARSE(parse("day06.input"));
   let input4 = solve_case<4>(input);
   AOC_EXPECT_RESULT(1361, input4[0]);
 
-  std::println("Part 2");
+  AOC_PART(2);
   let example14 = solve_case<14>(example);
   AOC_EXPECT_RESULT(19, example14[0]);
   AOC_EXPECT_RESULT(23, example14[1]);
@@ -105,13 +105,13 @@ fn solve_case2(Filesystem const& filesystem) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day07.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day07.example"));
   AOC_EXPECT_RESULT(95437, solve_case1(example));
-  let input = parse("day07.input");
+  let input = AOC_TIMED_PARSE(parse("day07.input"));
   AOC_EXPECT_RESULT(1453349, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(24933642, solve_case2(example));
   AOC_EXPECT_RESULT(2948823, solve_case2(input));
 
@@ -94,13 +94,13 @@ fn solve_case2(Forrest const& forrest) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day08.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day08.example"));
   AOC_EXPECT_RESULT(21, solve_case1(example));
-  let input = parse("day08.input");
+  let input = AOC_TIMED_PARSE(parse("day08.input"));
   AOC_EXPECT_RESULT(1681, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(8, solve_case2(example));
   AOC_EXPECT_RESULT(201684, solve_case2(input));
 }
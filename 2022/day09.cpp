@@ -37,7 +37,7 @@ auto parse(String const& filename) -> Moves {
 }
 
 template <usize num_knots>
-fn move_tail(std::array<point, num_knots>& rope, Visited& visited) {
+fn move_tail(std::array<point, num_knots>& rope, Vec<point>& tail_positions) {
   for (usize i = 1; i < num_knots; ++i) {
     let in_front = rope[i - 1];
     auto& current = rope[i];
@@ -47,7 +47,7 @@ fn move_tail(std::array<point, num_knots>& rope, Visited& visited) {
       current += diff.normal();
     }
   }
-  visited.insert(rope.back());
+  tail_positions.push_back(rope.back());
 }
 
 template <usize num_knots>
@@ -55,8 +55,9 @@ fn solve_case(Moves const& moves) -> usize {
   auto rope = std::array<point, num_knots>{};
   auto& head = rope.front();
 
-  auto visited = Visited{};
-  visited.insert(rope.back());
+  // Sorted and deduplicated once at the end,
+  // instead of shifting the set on every new position
+  auto tail_positions = Vec<point>{rope.back()};
 
   for (let diff : moves) {
     // Can only move vertically or horizontally
@@ -68,29 +69,29 @@ fn solve_case(Moves const& moves) -> usize {
     if (diff.x != 0) {
       for (int i = 0; i < diff_abs.x; ++i) {
         head.x += delta.x;
-        move_tail(rope, visited);
+        move_tail(rope, tail_positions);
       }
     } else {
       for (int i = 0; i < diff_abs.y; ++i) {
         head.y += delta.y;
-        move_tail(rope, visited);
+        move_tail(rope, tail_positions);
       }
     }
   }
 
-  return visited.size();
+  return Visited(std::move(tail_positions)).size();
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day09.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day09.example"));
   AOC_EXPECT_RESULT(13, solve_case<2>(example));
-  let input = parse("day09.input");
+  let input = AOC_TIMED_PARSE(parse("day09.input"));
   AOC_EXPECT_RESULT(5695, solve_case<2>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1, solve_case<10>(example));
-  let example2 = parse("day09.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day09.example2"));
   AOC_EXPECT_RESULT(36, solve_case<10>(example2));
   AOC_EXPECT_RESULT(2434, solve_case<10>(input));
 
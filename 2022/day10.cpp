@@ -86,15 +86,15 @@ fn solve_case(Instructions const& instructions) -> Result {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day10.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day10.example"));
   let[example_signal, example_monitor] = solve_case(example);
   AOC_EXPECT_RESULT(13140, example_signal);
-  let input = parse("day10.input");
+  let input = AOC_TIMED_PARSE(parse("day10.input"));
   let[input_signal, input_monitor] = solve_case(input);
   AOC_EXPECT_RESULT(11820, input_signal);
 
-  std::println("Part 2");
+  AOC_PART(2);
   constexpr let expected_example_out = str( //
       "##..##..##..##..##..##..##..##..##..##.."
       "###...###...###...###...###...###...###."
@@ -128,13 +128,13 @@ fn solve_case(Monkeys const& input) -> Item {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day11.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day11.example"));
   AOC_EXPECT_RESULT(10605, (solve_case<20, 3>(example)));
-  let input = parse("day11.input");
+  let input = AOC_TIMED_PARSE(parse("day11.input"));
   AOC_EXPECT_RESULT(98280, (solve_case<20, 3>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2713310158, (solve_case<10000, 1>(example)));
   AOC_EXPECT_RESULT(17673687232, (solve_case<10000, 1>(input)));
 
@@ -68,13 +68,13 @@ fn solve_case2(Input const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day12.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day12.example"));
   AOC_EXPECT_RESULT(31, solve_case1(example));
-  let input = parse("day12.input");
+  let input = AOC_TIMED_PARSE(parse("day12.input"));
   AOC_EXPECT_RESULT(504, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(29, solve_case2(example));
   AOC_EXPECT_RESULT(500, solve_case2(input));
 
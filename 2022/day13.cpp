@@ -105,8 +105,8 @@ fn solve_case1(Input const& input) -> u32 {
 
 fn solve_case2(Input const& input) -> u32 {
   auto packets = input | stdv::join | aoc::collect_vec<Packet>();
-  let p2 = parse_list_inner("[2]");
-  let p6 = parse_list_inner("[6]");
+  let p2 = AOC_TIMED_PARSE(parse_list_inner("[2]"));
+  let p6 = AOC_TIMED_PARSE(parse_list_inner("[6]"));
   packets.push_back(p2);
   packets.push_back(p6);
   stdr::sort(packets);
@@ -115,13 +115,13 @@ fn solve_case2(Input const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day13.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day13.example"));
   AOC_EXPECT_RESULT(13, solve_case1(example));
-  let input = parse("day13.input");
+  let input = AOC_TIMED_PARSE(parse("day13.input"));
   AOC_EXPECT_RESULT(5198, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(140, solve_case2(example));
   AOC_EXPECT_RESULT(22344, solve_case2(input));
 
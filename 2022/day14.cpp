@@ -186,13 +186,13 @@ auto solve_case(RockLines const& input) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day14.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day14.example"));
   AOC_EXPECT_RESULT(24, solve_case<false>(example));
-  let input = parse("day14.input");
+  let input = AOC_TIMED_PARSE(parse("day14.input"));
   AOC_EXPECT_RESULT(655, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(93, solve_case<true>(example));
   AOC_EXPECT_RESULT(26484, solve_case<true>(input));
 
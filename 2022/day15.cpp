@@ -5,6 +5,7 @@
 
 #ifndef AOC_IMPORT_STD
 #include <algorithm>
+#include <array>
 #include <print>
 #include <ranges>
 #endif
@@ -33,28 +34,19 @@ struct Input {
 fn parse(String const& filename) -> Input {
   Input result;
 
-  let convert_eq_str = [](str s) {
-    // Works for "x=" and "y="
-    return aoc::to_number<int>(aoc::trim(s).substr(2));
-  };
-
   for (str line : aoc::views::read_lines(filename)) {
-    auto [sensor_info, beacon_info] = aoc::split_once(line, ':');
-
-    // Don't include the space at end, the null terminator is counted instead
-    sensor_info = sensor_info.substr(sizeof("Sensor at"));
-    beacon_info = beacon_info.substr(sizeof("closest beacon is at"));
+    // Sensor at x=.., y=..: closest beacon is at x=.., y=..
+    let[sensor_x, sensor_y, beacon_x, beacon_y] =
+        aoc::parse_all_integers<std::array<int, 4>>(line);
 
     let beacon = [&] {
-      let[x_eq, y_eq] = aoc::split_once(beacon_info, ',');
-      let beacon = point{convert_eq_str(x_eq), convert_eq_str(y_eq)};
+      let beacon = point{beacon_x, beacon_y};
       result.min_max.update(beacon);
       result.beacons.push_back(beacon);
       return beacon;
     }();
     {
-      let[x_eq, y_eq] = aoc::split_once(sensor_info, ',');
-      let sensor = point{convert_eq_str(x_eq), convert_eq_str(y_eq)};
+      let sensor = point{sensor_x, sensor_y};
       result.min_max.update(sensor);
       let range = distance_manhattan(sensor, beacon);
       result.sensors.emplace_back(sensor, range);
@@ -195,13 +187,13 @@ fn solve_case2(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day15.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day15.example"));
   AOC_EXPECT_RESULT(26, solve_case1<10>(example));
-  let input = parse("day15.input");
+  let input = AOC_TIMED_PARSE(parse("day15.input"));
   AOC_EXPECT_RESULT(5870800, solve_case1<2000000>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(56000011, solve_case2<10>(example));
   AOC_EXPECT_RESULT(10908230916597, solve_case2<2000000>(input));
 
@@ -219,13 +219,13 @@ fn solve_case2(Input const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day16.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day16.example"));
   AOC_EXPECT_RESULT(1651, solve_case1(example));
-  let input = parse("day16.input");
+  let input = AOC_TIMED_PARSE(parse("day16.input"));
   AOC_EXPECT_RESULT(1647, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1707, solve_case2(example));
   AOC_EXPECT_RESULT(2169, solve_case2(input));
 
@@ -242,14 +242,14 @@ fn solve_case(Input const& pattern) -> rock_index_t {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day17.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day17.example"));
   AOC_EXPECT_RESULT(17, solve_case<10>(example));
   AOC_EXPECT_RESULT(3068, solve_case<2022>(example));
-  let input = parse("day17.input");
+  let input = AOC_TIMED_PARSE(parse("day17.input"));
   AOC_EXPECT_RESULT(3085, solve_case<2022>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1514285714288, solve_case<1000000000000>(example));
   AOC_EXPECT_RESULT(1535483870924, solve_case<1000000000000>(input));
 
@@ -111,15 +111,15 @@ fn solve_case2(Input const& droplets) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day18.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day18.example"));
   AOC_EXPECT_RESULT(10, solve_case1(example));
-  let example2 = parse("day18.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day18.example2"));
   AOC_EXPECT_RESULT(64, solve_case1(example2));
-  let input = parse("day18.input");
+  let input = AOC_TIMED_PARSE(parse("day18.input"));
   AOC_EXPECT_RESULT(4310, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(58, solve_case2(example2));
   AOC_EXPECT_RESULT(2466, solve_case2(input));
 
@@ -24,26 +24,18 @@ constexpr let GEODE_ID = NUM_ROBOTS - 1;
 fn parse(String const& filename) -> Vec<Blueprint> {
   return aoc::views::read_lines(filename) |
          stdv::transform([](str line) {
-           let[_, costs] = aoc::split_once(line, ':');
-           let[ore_robot, clay_robot, obsidian_robot, geode_robot] =
-               aoc::split_to_array<4>(costs, '.');
-
-           let ore_cost = aoc::split_to_array<1>(
-               ore_robot.substr(sizeof("Each ore robot costs ")), ' ');
-           let clay_cost = aoc::split_to_array<1>(
-               clay_robot.substr(sizeof("Each clay robot costs ")), ' ');
-           let obs_cost = aoc::split_to_array<4>(
-               obsidian_robot.substr(sizeof("Each obsidian robot costs ")),
-               ' ');
-           let geo_cost = aoc::split_to_array<4>(
-               geode_robot.substr(sizeof("Each geode robot costs ")), ' ');
-
-           let n = [](str s) { return static_cast<u8>(aoc::to_number<u8>(s)); };
+           let[_, ore, clay, obsidian_ore, obsidian_clay, geode_ore,
+               geode_obsidian] =
+               aoc::scan<"Blueprint {}: Each ore robot costs {} ore. "
+                         "Each clay robot costs {} ore. "
+                         "Each obsidian robot costs {} ore and {} clay. "
+                         "Each geode robot costs {} ore and {} obsidian.",
+                         int, u8, u8, u8, u8, u8, u8>(line);
            return Blueprint{
-               Resources{n(ore_cost[0]), 0, 0, 0},
-               Resources{n(clay_cost[0]), 0, 0, 0},
-               Resources{n(obs_cost[0]), n(obs_cost[3]), 0, 0},
-               Resources{n(geo_cost[0]), 0, n(geo_cost[3]), 0},
+               Resources{ore, 0, 0, 0},
+               Resources{clay, 0, 0, 0},
+               Resources{obsidian_ore, obsidian_clay, 0, 0},
+               Resources{geode_ore, 0, geode_obsidian, 0},
            };
          }) |
          aoc::collect_vec<Blueprint>();
@@ -96,12 +88,11 @@ struct SearchNode {
   }
 
   constexpr bool operator==(SearchNode const&) const = default;
-};
 
-// The node is 8 bytes of packed fields with no padding,
-// so it can be hashed as one word instead of field by field
-template <>
-struct std::hash<SearchNode> : aoc::packed_hash {};
+  // The node is 8 bytes of packed fields with no padding,
+  // so it can be hashed as one word instead of field by field
+  using aoc_hash = aoc::packed_hash;
+};
 
 fn clamp_resources(Resources const& max_resources, Resources const& resources,
                    Time time_left) -> Resources {
@@ -249,24 +240,29 @@ fn solve_case1(Vec<Blueprint> const& blueprints) -> u16 {
 
 fn solve_case2(Vec<Blueprint> const& blueprints) -> u16 {
   auto futures = Vec<std::future<u16>>{};
-  for (let& blueprint : blueprints | stdv::take(3)) {
-    futures.push_back(std::async(std::launch::async, [&blueprint] {
-      return max_open_geodes(blueprint, 32);
-    }));
+  {
+    AOC_TRACE_SCOPE("spawn");
+    for (let& blueprint : blueprints | stdv::take(3)) {
+      futures.push_back(std::async(std::launch::async, [&blueprint] {
+        AOC_TRACE_SCOPE("blueprint");
+        return max_open_geodes(blueprint, 32);
+      }));
+    }
   }
+  AOC_TRACE_SCOPE("join");
   return stdr::fold_left(
       futures | stdv::transform([](auto& f) { return f.get(); }), u16{1},
       std::multiplies{});
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day19.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day19.example"));
   AOC_EXPECT_RESULT(33, solve_case1(example));
-  let input = parse("day19.input");
+  let input = AOC_TIMED_PARSE(parse("day19.input"));
   AOC_EXPECT_RESULT(1395, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(56 * 62, solve_case2(example));
   AOC_EXPECT_RESULT(2700, solve_case2(input));
 
@@ -78,13 +78,22 @@ fn solve_case(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day20.example");
+  if (let scaled = aoc::harness::scaled_input()) {
+    let input = AOC_TIMED_PARSE(parse(*scaled));
+    AOC_PART(1);
+    AOC_SCALED_RESULT((solve_case<1, 1>(input)));
+    AOC_PART(2);
+    AOC_SCALED_RESULT((solve_case<10, 811589153>(input)));
+    AOC_RETURN_CHECK_RESULT();
+  }
+
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day20.example"));
   AOC_EXPECT_RESULT(3, (solve_case<1, 1>(example)));
-  let input = parse("day20.input");
+  let input = AOC_TIMED_PARSE(parse("day20.input"));
   AOC_EXPECT_RESULT(1591, (solve_case<1, 1>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1623178306, (solve_case<10, 811589153>(example)));
   AOC_EXPECT_RESULT(14579387544492, (solve_case<10, 811589153>(input)));
 
@@ -171,13 +171,13 @@ fn solve_case2(parsed_monkeys_t const& parsed_monkeys) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day21.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day21.example"));
   AOC_EXPECT_RESULT(152, solve_case1(example));
-  let input = parse("day21.input");
+  let input = AOC_TIMED_PARSE(parse("day21.input"));
   AOC_EXPECT_RESULT(291425799367130, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(301, solve_case2(example));
   AOC_EXPECT_RESULT(3219579395609, solve_case2(input));
 
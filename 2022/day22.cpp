@@ -336,13 +336,13 @@ fn solve_case2(input_t const& input) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day22.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day22.example"));
   AOC_EXPECT_RESULT(6032, solve_case1(example));
-  let input = parse("day22.input");
+  let input = AOC_TIMED_PARSE(parse("day22.input"));
   AOC_EXPECT_RESULT(97356, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(5031, (solve_case2<4>(example)));
   AOC_EXPECT_RESULT(120175, (solve_case2<50>(input)));
 
@@ -133,15 +133,15 @@ fn solve_case2(elves_t elves) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example2 = parse("day23.example2");
+  AOC_PART(1);
+  let example2 = AOC_TIMED_PARSE(parse("day23.example2"));
   AOC_EXPECT_RESULT(25, solve_case1(example2));
-  let example = parse("day23.example");
+  let example = AOC_TIMED_PARSE(parse("day23.example"));
   AOC_EXPECT_RESULT(110, solve_case1(example));
-  let input = parse("day23.input");
+  let input = AOC_TIMED_PARSE(parse("day23.input"));
   AOC_EXPECT_RESULT(3906, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(4, solve_case2(example2));
   AOC_EXPECT_RESULT(20, solve_case2(example));
   AOC_EXPECT_RESULT(895, solve_case2(input));
@@ -156,15 +156,15 @@ fn solve_case2(Input const& input) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day24.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day24.example"));
   AOC_EXPECT_RESULT(10, solve_case1(example));
-  let example2 = parse("day24.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day24.example2"));
   AOC_EXPECT_RESULT(18, solve_case1(example2));
-  let input = parse("day24.input");
+  let input = AOC_TIMED_PARSE(parse("day24.input"));
   AOC_EXPECT_RESULT(228, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(30, solve_case2(example));
   AOC_EXPECT_RESULT(54, solve_case2(example2));
   AOC_EXPECT_RESULT(723, solve_case2(input));
@@ -137,10 +137,10 @@ int main() {
   AOC_EXPECT_SAME_CONVERSION(5, 3, "1=");
   AOC_EXPECT_SAME_CONVERSION(5, 37, "122");
 
-  std::println("Part 1");
-  let example = parse("day25.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day25.example"));
   AOC_EXPECT_RESULT("2=-1=0", solve(example));
-  let input = parse("day25.input");
+  let input = AOC_TIMED_PARSE(parse("day25.input"));
   AOC_EXPECT_RESULT("2-=12=2-2-2-=0012==2", solve(input));
 
   AOC_RETURN_CHECK_RESULT();
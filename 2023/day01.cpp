@@ -73,14 +73,14 @@ fn solve_case2(std::span<const String> lines) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day01.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(142, solve_case1(example));
-  let input = parse("day01.input");
+  let input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(54388, solve_case1(input));
 
-  std::println("Part 2");
-  let example2 = parse("day01.example2");
+  AOC_PART(2);
+  let example2 = AOC_TIMED_PARSE(parse("day01.example2"));
   AOC_EXPECT_RESULT(281, solve_case2(example2));
   AOC_EXPECT_RESULT(53515, solve_case2(input));
 
@@ -109,13 +109,13 @@ static_assert(1560 == cube_power<config2>(std::span<const str>{
                            "5 green, 1 red"}}));
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day02.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day02.example"));
   AOC_EXPECT_RESULT(8, solve_case<config1>(example));
-  let input = parse("day02.input");
+  let input = AOC_TIMED_PARSE(parse("day02.input"));
   AOC_EXPECT_RESULT(2600, solve_case<config1>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2286, solve_case<config2>(example));
   AOC_EXPECT_RESULT(86036, solve_case<config2>(input));
 
@@ -138,13 +138,13 @@ fn solve_case(Vec<String> const& lines) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day03.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day03.example"));
   AOC_EXPECT_RESULT(4361, solve_case<false>(example));
-  let input = parse("day03.input");
+  let input = AOC_TIMED_PARSE(parse("day03.input"));
   AOC_EXPECT_RESULT(537732, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(467835, solve_case<true>(example));
   AOC_EXPECT_RESULT(84883664, solve_case<true>(input));
 
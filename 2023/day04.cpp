@@ -96,13 +96,13 @@ fn solve_case(Vec<CardStrings> const& cards) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day04.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day04.example"));
   AOC_EXPECT_RESULT(13, (solve_case<5, 8, false>(example)));
-  let input = parse("day04.input");
+  let input = AOC_TIMED_PARSE(parse("day04.input"));
   AOC_EXPECT_RESULT(32609, (solve_case<10, 25, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(30, (solve_case<5, 8, true>(example)));
   AOC_EXPECT_RESULT(14624680, (solve_case<10, 25, true>(input)));
 
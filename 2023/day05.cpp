@@ -204,13 +204,13 @@ fn solve_case(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day05.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day05.example"));
   AOC_EXPECT_RESULT(35, (solve_case<false>(example)));
-  let input = parse("day05.input");
+  let input = AOC_TIMED_PARSE(parse("day05.input"));
   AOC_EXPECT_RESULT(486613012, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(46, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(56931769, (solve_case<true>(input)));
 
@@ -83,13 +83,13 @@ fn solve_case2(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day06.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day06.example"));
   AOC_EXPECT_RESULT(288, solve_case1(example));
-  let input = parse("day06.input");
+  let input = AOC_TIMED_PARSE(parse("day06.input"));
   AOC_EXPECT_RESULT(1624896, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(71503, solve_case2(example));
   AOC_EXPECT_RESULT(32583852, solve_case2(input));
 
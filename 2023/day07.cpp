@@ -185,13 +185,13 @@ fn solve_case(Input const& raw) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day07.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day07.example"));
   AOC_EXPECT_RESULT(6440, (solve_case<false>(example)));
-  let input = parse("day07.input");
+  let input = AOC_TIMED_PARSE(parse("day07.input"));
   AOC_EXPECT_RESULT(249638405, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(5905, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(249776650, (solve_case<true>(input)));
 
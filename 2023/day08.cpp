@@ -119,18 +119,18 @@ fn solve_case(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day08.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day08.example"));
   AOC_EXPECT_RESULT(2, solve_case<false>(example));
-  let example2 = parse("day08.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day08.example2"));
   AOC_EXPECT_RESULT(6, solve_case<false>(example2));
-  let input = parse("day08.input");
+  let input = AOC_TIMED_PARSE(parse("day08.input"));
   AOC_EXPECT_RESULT(12737, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2, solve_case<true>(example));
   AOC_EXPECT_RESULT(6, solve_case<true>(example2));
-  let example3 = parse("day08.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day08.example3"));
   AOC_EXPECT_RESULT(6, solve_case<true>(example3));
   AOC_EXPECT_RESULT(9064949303801, solve_case<true>(input));
 
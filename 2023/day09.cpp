@@ -65,13 +65,13 @@ fn solve_case(Input const& input) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day09.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day09.example"));
   AOC_EXPECT_RESULT(114, solve_case<1>(example));
-  let input = parse("day09.input");
+  let input = AOC_TIMED_PARSE(parse("day09.input"));
   AOC_EXPECT_RESULT(1980437560, solve_case<1>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2, solve_case<-1>(example));
   AOC_EXPECT_RESULT(977, solve_case<-1>(input));
 
@@ -185,18 +185,18 @@ fn solve_case2(Input const& input) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day10.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day10.example"));
   AOC_EXPECT_RESULT(4, solve_case1(example));
-  let example2 = parse("day10.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day10.example2"));
   AOC_EXPECT_RESULT(8, solve_case1(example2));
-  let input = parse("day10.input");
+  let input = AOC_TIMED_PARSE(parse("day10.input"));
   AOC_EXPECT_RESULT(6820, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1, solve_case2(example));
   AOC_EXPECT_RESULT(1, solve_case2(example2));
-  let example3 = parse("day10.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day10.example3"));
   AOC_EXPECT_RESULT(4, solve_case2(example3));
   AOC_EXPECT_RESULT(337, solve_case2(input));
 
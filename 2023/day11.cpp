@@ -100,13 +100,13 @@ fn solve_case(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day11.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day11.example"));
   AOC_EXPECT_RESULT(374, (solve_case<2>(example)));
-  let input = parse("day11.input");
+  let input = AOC_TIMED_PARSE(parse("day11.input"));
   AOC_EXPECT_RESULT(10228230, (solve_case<2>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(1030, (solve_case<10>(example)));
   AOC_EXPECT_RESULT(8410, (solve_case<100>(example)));
   AOC_EXPECT_RESULT(82000210, (solve_case<1000000>(example)));
@@ -43,11 +43,12 @@ constexpr inline char unknown = '?';
 // but it is a win everywhere.
 // Sized from the input: the longest record is 20 springs and 6 groups,
 // and unfolding five times gives 20*5 plus 4 separators, and 6*5 groups.
+// A longer record still works, it just allocates.
 constexpr usize MAX_SPRINGS = 20 * 5 + 4;
 constexpr usize MAX_GROUPS = 6 * 5;
 
-using Springs = aoc::static_vector<char, MAX_SPRINGS>;
-using Groups = aoc::static_vector<u8, MAX_GROUPS>;
+using Springs = aoc::small_vector<char, MAX_SPRINGS>;
+using Groups = aoc::small_vector<u8, MAX_GROUPS>;
 
 struct SearchState {
   Springs springs;
@@ -59,20 +60,19 @@ struct SearchState {
   constexpr str springs_view() const {
     return str{springs.begin(), springs.end()};
   }
-};
 
-template <>
-struct std::hash<SearchState> {
-  // hash_combine avalanches, so the map can skip its own mixing step
-  using is_avalanching = void;
-
-  constexpr usize operator()(SearchState const& state) const {
-    auto combine = aoc::hash_combine{};
-    combine(state.springs);
-    combine(state.groups);
-    combine(state.damaged_before);
-    return combine.seed;
-  }
+  struct aoc_hash {
+    // hash_combine avalanches, so the map can skip its own mixing step
+    using is_avalanching = void;
+
+    constexpr usize operator()(SearchState const& state) const {
+      auto combine = aoc::hash_combine{};
+      combine(state.springs);
+      combine(state.groups);
+      combine(state.damaged_before);
+      return combine.seed;
+    }
+  };
 };
 
 using Neighbors = aoc::static_vector<SearchState, 2>;
@@ -158,10 +158,6 @@ fn count_arrangements(std::span<Record const> records) -> u64 {
         let unfolded_groups = stdv::repeat(record.groups, factor) |
                               stdv::join |
                               aoc::collect_vec<u8>();
-        AOC_ASSERT(unfolded_springs.size() <= MAX_SPRINGS,
-                   "Record is longer than the fixed springs capacity");
-        AOC_ASSERT(unfolded_groups.size() <= MAX_GROUPS,
-                   "Record has more groups than the fixed capacity");
         let start = SearchState{
             .springs =
                 Springs(unfolded_springs.begin(), unfolded_springs.end()),
@@ -185,33 +181,43 @@ fn solve_case(Input const& records) -> u64 {
       std::max((records.size() + num_threads - 1) / num_threads, 1uz);
 
   auto futures = Vec<std::future<u64>>{};
-  for (let chunk_index : Range{0uz, num_threads}) {
-    let offset = chunk_index * chunk_size;
-    if (offset >= records.size()) {
-      break;
+  {
+    AOC_TRACE_SCOPE("spawn");
+    for (let chunk_index : Range{0uz, num_threads}) {
+      let offset = chunk_index * chunk_size;
+      if (offset >= records.size()) {
+        break;
+      }
+      let count = std::min(chunk_size, records.size() - offset);
+      futures.push_back(std::async(
+          std::launch::async, [&records, chunk_index, offset, count] {
+            AOC_TRACE_SCOPE("chunk", static_cast<i64>(chunk_index));
+            return count_arrangements<factor>(
+                std::span{records}.subspan(offset, count));
+          }));
     }
-    let count = std::min(chunk_size, records.size() - offset);
-    futures.push_back(std::async(std::launch::async, [&records, offset, count] {
-      return count_arrangements<factor>(
-          std::span{records}.subspan(offset, count));
-    }));
   }
+  AOC_TRACE_SCOPE("join");
   return aoc::ranges::accumulate(
       futures | stdv::transform([](auto& f) { return f.get(); }), u64{0});
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day12.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day12.example"));
   AOC_EXPECT_RESULT(21, (solve_case<1>(example)));
-  let input = parse("day12.input");
+  let input = AOC_TIMED_PARSE(parse("day12.input"));
   AOC_EXPECT_RESULT(7379, (solve_case<1>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(206, (solve_case<2>(example)));
   AOC_EXPECT_RESULT(2612, (solve_case<3>(example)));
   AOC_EXPECT_RESULT(36308, (solve_case<4>(example)));
   AOC_EXPECT_RESULT(525152, (solve_case<5>(example)));
+  // Longer than any record of the inputs, unfolded it no longer fits inline
+  let long_record = AOC_TIMED_PARSE(parse("day12.example2"));
+  AOC_EXPECT_RESULT(204, (solve_case<1>(long_record)));
+  AOC_EXPECT_RESULT(1957976692044, (solve_case<5>(long_record)));
   AOC_EXPECT_RESULT(450228, (solve_case<2>(input)));
   AOC_EXPECT_RESULT(83673283, (solve_case<3>(input)));
   AOC_EXPECT_RESULT(23356098881, (solve_case<4>(input)));
@@ -264,15 +264,15 @@ fn solve_case(Input const& input) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day13.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day13.example"));
   AOC_EXPECT_RESULT(405, (solve_case<false>(example)));
-  let example2 = parse("day13.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day13.example2"));
   AOC_EXPECT_RESULT(712, (solve_case<false>(example2)));
-  let input = parse("day13.input");
+  let input = AOC_TIMED_PARSE(parse("day13.input"));
   AOC_EXPECT_RESULT(31265, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(400, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(1415, (solve_case<true>(example2)));
   AOC_EXPECT_RESULT(39359, (solve_case<true>(input)));
@@ -184,13 +184,13 @@ int main() {
                     rocks_fall(test_platform(), aoc::north).data());
   AOC_EXPECT_RESULT(136, north_load(rocks_fall(test_platform(), aoc::north)));
 
-  std::println("Part 1");
-  let example = parse("day14.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day14.example"));
   AOC_EXPECT_RESULT(136, (solve_case<false>(example)));
-  let input = parse("day14.input");
+  let input = AOC_TIMED_PARSE(parse("day14.input"));
   AOC_EXPECT_RESULT(108857, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(64, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(95273, (solve_case<true>(input)));
 
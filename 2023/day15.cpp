@@ -121,13 +121,13 @@ int solve_case(const steps_t& steps) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day15.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day15.example"));
   AOC_EXPECT_RESULT(1320, (solve_case<false>(example)));
-  const auto input = parse("day15.input");
+  const auto input = AOC_TIMED_PARSE(parse("day15.input"));
   AOC_EXPECT_RESULT(510273, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(145, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(212449, (solve_case<true>(input)));
 
@@ -130,13 +130,13 @@ int solve_case(const machine_t& machine) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day16.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day16.example"));
   AOC_EXPECT_RESULT(46, (solve_case<false>(example)));
-  const auto input = parse("day16.input");
+  const auto input = AOC_TIMED_PARSE(parse("day16.input"));
   AOC_EXPECT_RESULT(7798, (solve_case<false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(51, (solve_case<true>(example)));
   AOC_EXPECT_RESULT(8026, (solve_case<true>(input)));
 
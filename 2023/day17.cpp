@@ -19,20 +19,19 @@ struct node_t {
 
   constexpr bool operator==(node_t const&) const = default;
   constexpr auto operator<=>(node_t const&) const = default;
-};
 
-template <>
-struct std::hash<node_t> {
-  // hash_combine avalanches, so the map can skip its own mixing step
-  using is_avalanching = void;
-
-  constexpr usize operator()(node_t const& node) const {
-    auto combine = aoc::hash_combine{};
-    combine(node.pos);
-    combine(node.direction);
-    combine(node.consecutive);
-    return combine.seed;
-  }
+  struct aoc_hash {
+    // hash_combine avalanches, so the map can skip its own mixing step
+    using is_avalanching = void;
+
+    constexpr usize operator()(node_t const& node) const {
+      auto combine = aoc::hash_combine{};
+      combine(node.pos);
+      combine(node.direction);
+      combine(node.consecutive);
+      return combine.seed;
+    }
+  };
 };
 
 fn parse(String const& filename) -> city_block_t {
@@ -95,15 +94,15 @@ fn least_heat_loss(city_block_t const& city_block) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day17.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day17.example"));
   AOC_EXPECT_RESULT(102, (least_heat_loss<1, 3>(example)));
-  let input = parse("day17.input");
+  let input = AOC_TIMED_PARSE(parse("day17.input"));
   AOC_EXPECT_RESULT(967, (least_heat_loss<1, 3>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(94, (least_heat_loss<4, 10>(example)));
-  let example2 = parse("day17.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day17.example2"));
   AOC_EXPECT_RESULT(71, (least_heat_loss<4, 10>(example2)));
   AOC_EXPECT_RESULT(1101, (least_heat_loss<4, 10>(input)));
 
@@ -90,13 +90,13 @@ fn solve_case2(Vec<String> const& lines) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day18.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day18.example"));
   AOC_EXPECT_RESULT(62, solve_case1(example));
-  let input = parse("day18.input");
+  let input = AOC_TIMED_PARSE(parse("day18.input"));
   AOC_EXPECT_RESULT(40745, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(952408144115, solve_case2(example));
   AOC_EXPECT_RESULT(90111113594927, solve_case2(input));
 
@@ -37,6 +37,7 @@ struct input_t {
   Vec<part_t> parts;
   workflows_t workflows;
   usize start;
+  AOC_SNAPSHOT_FIELDS(parts, workflows, start)
 };
 
 fn rule_matches(part_t const& part, rule_t const& rule) -> bool {
@@ -225,13 +226,13 @@ fn solve_case2(input_t const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day19.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day19.example"));
   AOC_EXPECT_RESULT(19114, solve_case1(example));
-  let input = parse("day19.input");
+  let input = AOC_CACHED_PARSE(parse, "day19.input");
   AOC_EXPECT_RESULT(509597, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(167409079868000, solve_case2(example));
   AOC_EXPECT_RESULT(143219569011526, solve_case2(input));
 
@@ -210,15 +210,15 @@ fn solve_case2(input_t input) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day20.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day20.example"));
   AOC_EXPECT_RESULT(32000000, solve_case1(example));
-  let example2 = parse("day20.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day20.example2"));
   AOC_EXPECT_RESULT(11687500, solve_case1(example2));
-  let input = parse("day20.input");
+  let input = AOC_TIMED_PARSE(parse("day20.input"));
   AOC_EXPECT_RESULT(814934624, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(1337, solve_case2(input));
 
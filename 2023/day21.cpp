@@ -100,13 +100,13 @@ fn solve_case(input_t input) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day21.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day21.example"));
   AOC_EXPECT_RESULT(16, (solve_case<6, false>(example)));
-  let input = parse("day21.input");
+  let input = AOC_TIMED_PARSE(parse("day21.input"));
   AOC_EXPECT_RESULT(3646, (solve_case<64, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(16, (solve_case<6, true>(example)));
   AOC_EXPECT_RESULT(50, (solve_case<10, true>(example)));
   AOC_EXPECT_RESULT(1594, (solve_case<50, true>(example)));
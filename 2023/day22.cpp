@@ -127,17 +127,17 @@ fn solve_case2(brick_list_t bricks) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day22.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day22.example"));
   AOC_EXPECT_RESULT(5, solve_case1(example));
-  let example2 = parse("day22.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day22.example2"));
   AOC_EXPECT_RESULT(3, solve_case1(example2));
-  let example3 = parse("day22.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day22.example3"));
   AOC_EXPECT_RESULT(2, solve_case1(example3));
-  let input = parse("day22.input");
+  let input = AOC_TIMED_PARSE(parse("day22.input"));
   AOC_EXPECT_RESULT(465, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(7, solve_case2(example));
   AOC_EXPECT_RESULT(1, solve_case2(example2));
   AOC_EXPECT_RESULT(3, solve_case2(example3));
@@ -153,13 +153,13 @@ fn solve_case2(island_t const& island_map) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day23.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day23.example"));
   AOC_EXPECT_RESULT(94, solve_case1(example));
-  let input = parse("day23.input");
+  let input = AOC_TIMED_PARSE(parse("day23.input"));
   AOC_EXPECT_RESULT(2326, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(154, solve_case2(example));
   AOC_EXPECT_RESULT(6574, solve_case2(input));
 
@@ -4,6 +4,7 @@
 #include "../common/rust.h"
 
 #ifndef AOC_IMPORT_STD
+#include <array>
 #include <print>
 #endif
 
@@ -19,9 +20,10 @@ using hailstones_t = Vec<hailstone_t>;
 fn parse(const String& filename) -> hailstones_t {
   return aoc::views::read_lines(filename) |
          stdv::transform([](str line) {
-           let[pos_str, vel_str] = aoc::split_once(line, " @ ");
-           return hailstone_t{aoc::split<Vec3>(pos_str, ',', aoc::trimmer{}),
-                              aoc::split<Vec3>(vel_str, ',', aoc::trimmer{})};
+           // Exact integers, too large for an int
+           let[px, py, pz, vx, vy, vz] =
+               aoc::parse_all_integers<std::array<i64, 6>>(line);
+           return hailstone_t{Vec3{px, py, pz}, Vec3{vx, vy, vz}};
          }) |
          aoc::collect_vec<hailstone_t>();
 }
@@ -80,10 +82,10 @@ fn solve_case1(const hailstones_t& hailstones) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day24.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day24.example"));
   AOC_EXPECT_RESULT(2, (solve_case1<7, 27>(example)));
-  let input = parse("day24.input");
+  let input = AOC_TIMED_PARSE(parse("day24.input"));
   AOC_EXPECT_RESULT(21785,
                     (solve_case1<200000000000000, 400000000000000>(input)));
 
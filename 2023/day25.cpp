@@ -20,9 +20,9 @@ struct GraphArc {
   constexpr bool operator==(GraphArc const&) const = default;
 
   fn reversed() const -> GraphArc { return {to, from}; }
+
+  using aoc_hash = aoc::packed_hash;
 };
-template <>
-struct std::hash<GraphArc> : aoc::packed_hash {};
 static_assert(aoc::hashable<GraphArc>);
 
 // How many remaining units of flow each arc can still carry
@@ -132,12 +132,12 @@ fn solve_case(Graph const& graph) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day25.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day25.example"));
   AOC_EXPECT_RESULT(54, solve_case(example));
-  let input = parse("day25.input");
+  let input = AOC_TIMED_PARSE(parse("day25.input"));
   AOC_EXPECT_RESULT(601344, solve_case(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
 }
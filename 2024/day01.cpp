@@ -39,10 +39,19 @@ static_assert(sum_diffs({3, 4, 2, 1, 3, 3}, {4, 3, 5, 3, 9, 3}) == 11);
 
 fn similarity_score(Vec<i32> const& left_list, Vec<i32> const& right_list)
     -> i32 {
-  auto right_counts = aoc::flat_map<i32, i32>{};
-  for (auto value : right_list) {
-    ++right_counts[value];
+  // Counted off the sorted list, the map takes them in order as they are
+  auto values = Vec<i32>{};
+  auto counts = Vec<i32>{};
+  for (let value : aoc::ranges::sorted(right_list)) {
+    if (values.empty() || (values.back() != value)) {
+      values.push_back(value);
+      counts.push_back(0);
+    }
+    ++counts.back();
   }
+  // Built once and searched once per value of the left list
+  let right_counts = aoc::eytzinger_map<i32, i32>{
+      aoc::sorted_unique, std::move(values), std::move(counts)};
 
   return aoc::ranges::accumulate(
       left_list | stdv::transform([&](i32 value) {
@@ -62,13 +71,13 @@ static_assert(similarity_score({3, 4, 2, 1, 3}, {4, 3, 5, 3, 9, 3}) == 22);
 static_assert(similarity_score({3, 4, 2, 1, 3, 3}, {4, 3, 5, 3, 9, 3}) == 31);
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day01.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(11, sum_diffs(example.left, example.right));
-  let input = parse("day01.input");
+  let input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(3569916, sum_diffs(input.left, input.right));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(31, similarity_score(example.left, example.right));
   AOC_EXPECT_RESULT(26407426, similarity_score(input.left, input.right));
 
@@ -67,13 +67,13 @@ fn solve_case(Vec<Report> const& reports) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day02.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day02.example"));
   AOC_EXPECT_RESULT(2, solve_case<false>(example));
-  let input = parse("day02.input");
+  let input = AOC_TIMED_PARSE(parse("day02.input"));
   AOC_EXPECT_RESULT(502, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(4, solve_case<true>(example));
   AOC_EXPECT_RESULT(544, solve_case<true>(input));
 
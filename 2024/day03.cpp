@@ -121,15 +121,15 @@ static_assert(1019406 == parse_multiplications(
                              "[#from())when()/}+%mul(982,733)mul(700,428)}}"));
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day03.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day03.example"));
   AOC_EXPECT_RESULT(161, parse_multiplications(example));
-  let example2 = parse("day03.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day03.example2"));
   AOC_EXPECT_RESULT(161, parse_multiplications(example2));
-  let input = parse("day03.input");
+  let input = AOC_TIMED_PARSE(parse("day03.input"));
   AOC_EXPECT_RESULT(174960292, parse_multiplications(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(161, parse_multiplications_with_enablers(example));
   AOC_EXPECT_RESULT(48, parse_multiplications_with_enablers(example2));
   AOC_EXPECT_RESULT(56275602, parse_multiplications_with_enablers(input));
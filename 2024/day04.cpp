@@ -242,15 +242,15 @@ fn solve_case2(word_board_t const& board) -> u32 {
 // MAIN
 
 int main() {
-  std::println("Part 1");
-  let example2 = parse("day04.example2");
+  AOC_PART(1);
+  let example2 = AOC_TIMED_PARSE(parse("day04.example2"));
   AOC_EXPECT_RESULT(4, solve_case1(example2));
-  let example = parse("day04.example");
+  let example = AOC_TIMED_PARSE(parse("day04.example"));
   AOC_EXPECT_RESULT(18, solve_case1(example));
-  let input = parse("day04.input");
+  let input = AOC_TIMED_PARSE(parse("day04.input"));
   AOC_EXPECT_RESULT(2517, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(9, solve_case2(example));
   AOC_EXPECT_RESULT(1960, solve_case2(input));
 
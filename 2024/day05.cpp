@@ -27,9 +27,11 @@ struct Input {
   Vec<update_t> updates;
 };
 
-fn parse(String const& filename) -> Input {
-  let lines = aoc::views::read_lines(filename, aoc::keep_empty{}) |
-              aoc::collect_vec<String>();
+fn parse(String const& filename,
+         usize block_size = aoc::chunked_reader::default_block_size)
+    -> Input {
+  auto reader = aoc::chunked_reader{filename, block_size};
+  let lines = reader.lines(aoc::keep_empty{}) | aoc::collect_vec<String>();
   let separator_it = stdr::find(lines, "");
 
   // We use the vector as a hashmap, so we need to use enough memory
@@ -104,17 +106,20 @@ fn solve_case(Input const& input) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example2 = parse("day05.example2");
+  AOC_PART(1);
+  let example2 = AOC_TIMED_PARSE(parse("day05.example2"));
   AOC_EXPECT_RESULT(61, solve_case<false>(example2));
-  let example3 = parse("day05.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day05.example3"));
   AOC_EXPECT_RESULT(0, solve_case<false>(example3));
-  let example = parse("day05.example");
+  let example = AOC_TIMED_PARSE(parse("day05.example"));
   AOC_EXPECT_RESULT(143, solve_case<false>(example));
-  let input = parse("day05.input");
+  // The empty line between the rules and the updates is kept,
+  // read in blocks smaller than the lines around it as well
+  AOC_EXPECT_RESULT(143, solve_case<false>(parse("day05.example", 4)));
+  let input = AOC_TIMED_PARSE(parse("day05.input"));
   AOC_EXPECT_RESULT(6034, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(0, solve_case<true>(example2));
   AOC_EXPECT_RESULT(47, solve_case<true>(example3));
   AOC_EXPECT_RESULT(123, solve_case<true>(example));
@@ -164,13 +164,13 @@ fn solve_part2(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day06.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day06.example"));
   AOC_EXPECT_RESULT(41, solve_part1(example));
-  let input = parse("day06.input");
+  let input = AOC_TIMED_PARSE(parse("day06.input"));
   AOC_EXPECT_RESULT(5030, solve_part1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(6, solve_part2(example));
   AOC_EXPECT_RESULT(1928, solve_part2(input));
 
@@ -87,8 +87,9 @@ using equations_t = std::vector<equation_t>;
 
 equations_t parse(const std::string& filename) {
   equations_t equations;
+  const auto input = aoc::mapped_file{filename};
 
-  for (std::string_view line : aoc::views::read_lines(filename)) {
+  for (std::string_view line : input.lines()) {
     auto [test_value_str, operands_str] = aoc::split_once(line, ':');
     equations.emplace_back(aoc::to_number<int_t>(test_value_str),
                            aoc::split<operands_t>(operands_str.substr(1), ' '));
@@ -109,13 +110,13 @@ int_t solve_case(const equations_t& equations) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day07.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day07.example"));
   AOC_EXPECT_RESULT(3749, solve_case<false>(example));
-  const auto input = parse("day07.input");
+  const auto input = AOC_TIMED_PARSE(parse("day07.input"));
   AOC_EXPECT_RESULT(5702958180383, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(11387, solve_case<true>(example));
   AOC_EXPECT_RESULT(92612386119138, solve_case<true>(input));
 
@@ -98,13 +98,13 @@ int solve_case(const map_t& map) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day08.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day08.example"));
   AOC_EXPECT_RESULT(14, solve_case<false>(example));
-  const auto input = parse("day08.input");
+  const auto input = AOC_TIMED_PARSE(parse("day08.input"));
   AOC_EXPECT_RESULT(220, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(34, solve_case<true>(example));
   AOC_EXPECT_RESULT(813, solve_case<true>(input));
 
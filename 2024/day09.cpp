@@ -191,13 +191,22 @@ int_t solve_case(const std::string& disk_map) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day09.example");
+  if (const auto scaled = aoc::harness::scaled_input()) {
+    const auto input = AOC_TIMED_PARSE(parse(*scaled));
+    AOC_PART(1);
+    AOC_SCALED_RESULT(solve_case<false>(input));
+    AOC_PART(2);
+    AOC_SCALED_RESULT(solve_case<true>(input));
+    AOC_RETURN_CHECK_RESULT();
+  }
+
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day09.example"));
   AOC_EXPECT_RESULT(1928, solve_case<false>(example));
-  const auto input = parse("day09.input");
+  const auto input = AOC_TIMED_PARSE(parse("day09.input"));
   AOC_EXPECT_RESULT(6432869891895, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2858, solve_case<true>(example));
   AOC_EXPECT_RESULT(6467290479134, solve_case<true>(input));
 
@@ -91,18 +91,18 @@ struct SearchState {
   Vec<point> trail;
 
   constexpr bool operator==(SearchState const&) const = default;
-};
-template <>
-struct std::hash<SearchState> {
-  // hash_combine avalanches, so the map can skip its own mixing step
-  using is_avalanching = void;
-
-  constexpr usize operator()(SearchState const& state) const {
-    auto combine = aoc::hash_combine{};
-    combine(state.pos);
-    combine(state.trail);
-    return combine.seed;
-  }
+
+  struct aoc_hash {
+    // hash_combine avalanches, so the map can skip its own mixing step
+    using is_avalanching = void;
+
+    constexpr usize operator()(SearchState const& state) const {
+      auto combine = aoc::hash_combine{};
+      combine(state.pos);
+      combine(state.trail);
+      return combine.seed;
+    }
+  };
 };
 
 fn get_rating(top_map_t const& top_map, point trailhead) -> usize {
@@ -142,15 +142,15 @@ fn solve_case2(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day10.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day10.example"));
   AOC_EXPECT_RESULT(1, solve_case1(example));
-  let example2 = parse("day10.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day10.example2"));
   AOC_EXPECT_RESULT(36, solve_case1(example2));
-  let input = parse("day10.input");
+  let input = AOC_TIMED_PARSE(parse("day10.input"));
   AOC_EXPECT_RESULT(652, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(81, solve_case2(example2));
   AOC_EXPECT_RESULT(1432, solve_case2(input));
 
@@ -52,13 +52,13 @@ fn solve_case(stones_t const& stones) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day11.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day11.example"));
   AOC_EXPECT_RESULT(55312, solve_case<25>(example));
-  let input = parse("day11.input");
+  let input = AOC_TIMED_PARSE(parse("day11.input"));
   AOC_EXPECT_RESULT(191690, solve_case<25>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(65601038650482, solve_case<75>(example));
   AOC_EXPECT_RESULT(228651922369703, solve_case<75>(input));
 
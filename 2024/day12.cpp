@@ -158,21 +158,21 @@ fn solve_case2(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day12.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day12.example"));
   AOC_EXPECT_RESULT(140, solve_case1(example));
-  let example2 = parse("day12.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day12.example2"));
   AOC_EXPECT_RESULT(772, solve_case1(example2));
-  let example3 = parse("day12.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day12.example3"));
   AOC_EXPECT_RESULT(1930, solve_case1(example3));
-  let example4 = parse("day12.example4");
+  let example4 = AOC_TIMED_PARSE(parse("day12.example4"));
   AOC_EXPECT_RESULT(692, solve_case1(example4));
-  let example5 = parse("day12.example5");
+  let example5 = AOC_TIMED_PARSE(parse("day12.example5"));
   AOC_EXPECT_RESULT(1184, solve_case1(example5));
-  let input = parse("day12.input");
+  let input = AOC_TIMED_PARSE(parse("day12.input"));
   AOC_EXPECT_RESULT(1450422, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(80, solve_case2(example));
   AOC_EXPECT_RESULT(436, solve_case2(example2));
   AOC_EXPECT_RESULT(1206, solve_case2(example3));
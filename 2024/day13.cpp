@@ -128,13 +128,13 @@ int_t solve_case(const machines_t& parsed_machines) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day13.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day13.example"));
   AOC_EXPECT_RESULT(480, solve_case<false>(example));
-  const auto input = parse("day13.input");
+  const auto input = AOC_TIMED_PARSE(parse("day13.input"));
   AOC_EXPECT_RESULT(38714, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT((459236326669 + 416082282239), solve_case<true>(example));
   AOC_EXPECT_RESULT(74015623345775, solve_case<true>(input));
 
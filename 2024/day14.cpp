@@ -58,10 +58,9 @@ std::vector<robot_t> parse(const std::string& filename) {
   std::vector<robot_t> robots;
 
   for (std::string_view line : aoc::views::read_lines(filename)) {
-    auto [pos, vel] = aoc::split_once(line, ' ');
-    auto position = aoc::split<point>(pos.substr(2), ',');
-    auto velocity = aoc::split<point>(vel.substr(2), ',');
-    robots.push_back({position, velocity});
+    // p=x,y v=dx,dy
+    auto [x, y, dx, dy] = aoc::parse_all_integers<std::array<int, 4>>(line);
+    robots.push_back({point{x, y}, point{dx, dy}});
   }
 
   return robots;
@@ -76,13 +75,13 @@ int solve_case(const std::vector<robot_t>& robots) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day14.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day14.example"));
   AOC_EXPECT_RESULT(12, (solve_case<{11, 7}, 100>(example)));
-  const auto input = parse("day14.input");
+  const auto input = AOC_TIMED_PARSE(parse("day14.input"));
   AOC_EXPECT_RESULT(221655456, (solve_case<{101, 103}, 100>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(281, (solve_case<{11,7},true>(example)));
   // AOC_EXPECT_RESULT(53515, (solve_case<{101, 103},true>(input)));
@@ -304,17 +304,17 @@ fn solve_case(Input const& input) -> int {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day15.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day15.example"));
   AOC_EXPECT_RESULT(10092, solve_case<false>(example));
-  let example2 = parse("day15.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day15.example2"));
   AOC_EXPECT_RESULT(2028, solve_case<false>(example2));
-  let example3 = parse("day15.example3");
+  let example3 = AOC_TIMED_PARSE(parse("day15.example3"));
   AOC_EXPECT_RESULT(908, solve_case<false>(example3));
-  let input = parse("day15.input");
+  let input = AOC_TIMED_PARSE(parse("day15.input"));
   AOC_EXPECT_RESULT(1514353, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(9021, solve_case<true>(example));
   AOC_EXPECT_RESULT(1751, solve_case<true>(example2));
   AOC_EXPECT_RESULT(618, solve_case<true>(example3));
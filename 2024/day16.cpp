@@ -182,21 +182,21 @@ int solve_case(const maze_input_t& input) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day16.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day16.example"));
   AOC_EXPECT_RESULT(7036, solve_case<false>(example));
-  const auto example2 = parse("day16.example2");
+  const auto example2 = AOC_TIMED_PARSE(parse("day16.example2"));
   AOC_EXPECT_RESULT(11048, solve_case<false>(example2));
   // https://www.reddit.com/r/adventofcode/comments/1hfhgl1/2024_day_16_part_1_alternate_test_case/
-  const auto example3 = parse("day16.example3");
+  const auto example3 = AOC_TIMED_PARSE(parse("day16.example3"));
   AOC_EXPECT_RESULT(21148, solve_case<false>(example3));
   // https://www.reddit.com/r/adventofcode/comments/1hgyuqm/2024_day_16_part_1/
-  const auto example4 = parse("day16.example4");
+  const auto example4 = AOC_TIMED_PARSE(parse("day16.example4"));
   AOC_EXPECT_RESULT(5027, solve_case<false>(example4));
-  const auto input = parse("day16.input");
+  const auto input = AOC_TIMED_PARSE(parse("day16.input"));
   AOC_EXPECT_RESULT(94436, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(45, solve_case<true>(example));
   AOC_EXPECT_RESULT(64, solve_case<true>(example2));
   AOC_EXPECT_RESULT(481, solve_case<true>(input));
@@ -167,15 +167,15 @@ fn solve_case2(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day17.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day17.example"));
   AOC_EXPECT_RESULT("4,6,3,5,6,3,5,2,1,0", solve_case1(example));
-  let example2 = parse("day17.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day17.example2"));
   AOC_EXPECT_RESULT("5,7,3,0", solve_case1(example2));
-  let input = parse("day17.input");
+  let input = AOC_TIMED_PARSE(parse("day17.input"));
   AOC_EXPECT_RESULT("1,7,6,5,1,0,5,0,7", solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(117440, solve_case2(example2));
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(1337, solve_case2(input));
@@ -114,13 +114,13 @@ auto solve_case(const std::vector<point>& falling_bytes) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day18.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day18.example"));
   AOC_EXPECT_RESULT(22, (solve_case<{7, 7}, 12, false>(example)));
-  const auto input = parse("day18.input");
+  const auto input = AOC_TIMED_PARSE(parse("day18.input"));
   AOC_EXPECT_RESULT(234, (solve_case<{71, 71}, 1024, false>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT((point{6, 1}), (solve_case<{7, 7}, 12, true>(example)));
   AOC_EXPECT_RESULT((point{58, 19}), (solve_case<{71, 71}, 1024, true>(input)));
 
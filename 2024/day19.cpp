@@ -92,13 +92,13 @@ fn solve_case(Input const& input) -> i64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day19.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day19.example"));
   AOC_EXPECT_RESULT(6, solve_case<false>(example));
-  let input = parse("day19.input");
+  let input = AOC_TIMED_PARSE(parse("day19.input"));
   AOC_EXPECT_RESULT(317, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(16, solve_case<true>(example));
   AOC_EXPECT_RESULT(883443544805484, solve_case<true>(input));
 
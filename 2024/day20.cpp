@@ -71,13 +71,13 @@ fn solve_case(Input const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day20.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day20.example"));
   AOC_EXPECT_RESULT(5, (solve_case<20, 2>(example)));
-  let input = parse("day20.input");
+  let input = AOC_TIMED_PARSE(parse("day20.input"));
   AOC_EXPECT_RESULT(1459, (solve_case<100, 2>(input)));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(285, (solve_case<50, 20>(example)));
   AOC_EXPECT_RESULT(1016066, (solve_case<100, 20>(input)));
 
@@ -171,12 +171,12 @@ fn solve_case1(Input const& input) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day21.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day21.example"));
   AOC_EXPECT_RESULT(126384, solve_case1(example));
-  let input = parse("day21.input");
+  let input = AOC_TIMED_PARSE(parse("day21.input"));
   AOC_EXPECT_RESULT(231564, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
 }
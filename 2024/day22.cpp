@@ -125,13 +125,13 @@ int_t solve_case(const std::vector<int>& buyer_starters) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day22.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day22.example"));
   AOC_EXPECT_RESULT(37327623, solve_case<false>(example));
-  const auto input = parse("day22.input");
+  const auto input = AOC_TIMED_PARSE(parse("day22.input"));
   AOC_EXPECT_RESULT(20215960478, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
 
   // The following two calls can't be static_assert because of compiler limits
   AOC_EXPECT_RESULT(9, most_bananas(std::array{123}));
@@ -12,27 +12,28 @@
 #endif
 
 // Every node name is two lowercase letters,
-// so 26*26 ids is enough for any input.
-constexpr usize max_nodes = 26 * 26;
+// read directly as an id below 26*26.
+using NameToId = aoc::fixed_name_to_id<2>;
+constexpr usize max_nodes = NameToId::capacity;
 
-// The subset mask in candidates_for_node is a u32,
-// so a node can have at most 31 neighbors.
-// Real inputs stay well under it.
+// Real inputs have 13 neighbors per node, held inline,
+// more spill to the heap.
 constexpr usize max_degree = 13;
-using Connections = aoc::static_vector<i32, max_degree>;
+using Connections = aoc::small_vector<i32, max_degree>;
 using Graph = Vec<Connections>;
 
 struct Input {
   Graph graph;
   Vec<String> names;
+  AOC_SNAPSHOT_FIELDS(graph, names)
 };
 
 struct Triangle {
   std::array<i32, 3> ids;
   constexpr bool operator==(Triangle const&) const = default;
+
+  using aoc_hash = aoc::packed_hash;
 };
-template <>
-struct std::hash<Triangle> : aoc::packed_hash {};
 static_assert(aoc::hashable<Triangle>);
 
 // A clique candidate as a bitmask over node ids instead of a sorted Vec<i32>.
@@ -74,7 +75,7 @@ fn to_ids(CandidateBits const& bits) -> Vec<i32> {
 }
 
 auto parse(String const& filename) -> Input {
-  auto name_to_id = aoc::name_to_id{};
+  auto name_to_id = NameToId{};
   auto input = Input{};
   for (str line : aoc::views::read_lines(filename)) {
     let[a, b] = aoc::split_once(line, '-');
@@ -122,6 +123,7 @@ fn solve_case1(Input const& input) -> i32 {
 fn candidates_for_node(i32 id, Connections const& connections,
                        Vec<CandidateBits>& out) {
   let degree = connections.size();
+  AOC_ASSERT(degree < 32, "The subset mask is a u32, at most 31 neighbors");
   for (u32 mask = 0; mask < (u32{1} << degree); ++mask) {
     // +1 for `id` itself, needs at least 3 to matter (see part 1)
     if (static_cast<usize>(std::popcount(mask)) + 1 < 3) {
@@ -147,12 +149,15 @@ fn solve_case2(Input const& input) -> String {
   // each appending to its own local vector.
   auto local_candidates = Vec<Vec<CandidateBits>>(num_threads);
   {
+    // Outlives the threads, so it covers joining them as well
+    AOC_TRACE_SCOPE("spawn and join");
     auto threads = Vec<std::jthread>{};
     threads.reserve(num_threads);
     for (let t : Range{0uz, num_threads}) {
       let start_id = t * chunk_size;
       let end_id = std::min(start_id + chunk_size, input.graph.size());
       threads.emplace_back([&, start_id, end_id, t] {
+        AOC_TRACE_SCOPE("chunk", static_cast<i64>(t));
         // One upfront reserve for the whole chunk
         // instead of growing incrementally:
         // reserve() sizes to exactly what's asked,
@@ -227,13 +232,13 @@ fn solve_case2(Input const& input) -> String {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day23.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day23.example"));
   AOC_EXPECT_RESULT(7, solve_case1(example));
-  let input = parse("day23.input");
+  let input = AOC_CACHED_PARSE(parse, "day23.input");
   AOC_EXPECT_RESULT(1348, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT("co,de,ka,ta", solve_case2(example));
   AOC_EXPECT_RESULT("am,bv,ea,gh,is,iy,ml,nj,nl,no,om,tj,yv",
                     solve_case2(input));
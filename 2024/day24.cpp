@@ -165,15 +165,15 @@ int_t solve_case(const device_t& device) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day24.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day24.example"));
   AOC_EXPECT_RESULT(4, solve_case<false>(example));
-  const auto example2 = parse("day24.example2");
+  const auto example2 = AOC_TIMED_PARSE(parse("day24.example2"));
   AOC_EXPECT_RESULT(2024, solve_case<false>(example2));
-  const auto input = parse("day24.input");
+  const auto input = AOC_TIMED_PARSE(parse("day24.input"));
   AOC_EXPECT_RESULT(64755511006320, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(281, solve_case<true>(example));
   // AOC_EXPECT_RESULT(53515, solve_case<true>(input));
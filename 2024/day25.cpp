@@ -93,13 +93,13 @@ int solve_case(const schematics_t& schematics) {
 }
 
 int main() {
-  std::println("Part 1");
-  const auto example = parse("day25.example");
+  AOC_PART(1);
+  const auto example = AOC_TIMED_PARSE(parse("day25.example"));
   AOC_EXPECT_RESULT(3, solve_case<false>(example));
-  const auto input = parse("day25.input");
+  const auto input = AOC_TIMED_PARSE(parse("day25.input"));
   AOC_EXPECT_RESULT(3338, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   aoc::return_incomplete();
   // AOC_EXPECT_RESULT(281, solve_case<true>(example));
   // AOC_EXPECT_RESULT(53515, solve_case<true>(input));
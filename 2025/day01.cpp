@@ -50,13 +50,13 @@ fn solve_case2(std::span<const i32> sequence) -> i32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day01.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day01.example"));
   AOC_EXPECT_RESULT(3, solve_case1(example));
-  let input = parse("day01.input");
+  let input = AOC_TIMED_PARSE(parse("day01.input"));
   AOC_EXPECT_RESULT(1048, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(6, solve_case2(example));
   AOC_EXPECT_RESULT(6498, solve_case2(input));
 
@@ -79,13 +79,13 @@ fn solve_case2(std::span<const range_t> ranges) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day02.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day02.example"));
   AOC_EXPECT_RESULT(1227775554, solve_case1(example));
-  let input = parse("day02.input");
+  let input = AOC_TIMED_PARSE(parse("day02.input"));
   AOC_EXPECT_RESULT(30323879646, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(4174379265, solve_case2(example));
   AOC_EXPECT_RESULT(43872163557, solve_case2(input));
 
@@ -70,13 +70,13 @@ fn solve_case(Batteries const& batteries) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day03.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day03.example"));
   AOC_EXPECT_RESULT(357, solve_case<2>(example));
-  let input = parse("day03.input");
+  let input = AOC_TIMED_PARSE(parse("day03.input"));
   AOC_EXPECT_RESULT(17166, solve_case<2>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3121910778619, solve_case<12>(example));
   AOC_EXPECT_RESULT(169077317650774, solve_case<12>(input));
 
@@ -56,13 +56,13 @@ fn solve_case2(PaperRolls const& input) -> u32 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day04.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day04.example"));
   AOC_EXPECT_RESULT(13, solve_case1(example));
-  let input = parse("day04.input");
+  let input = AOC_TIMED_PARSE(parse("day04.input"));
   AOC_EXPECT_RESULT(1553, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(43, solve_case2(example));
   AOC_EXPECT_RESULT(8442, solve_case2(input));
 
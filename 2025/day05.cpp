@@ -69,13 +69,13 @@ fn solve_case2(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day05.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day05.example"));
   AOC_EXPECT_RESULT(3, solve_case1(example));
-  let input = parse("day05.input");
+  let input = AOC_TIMED_PARSE(parse("day05.input"));
   AOC_EXPECT_RESULT(821, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(14, solve_case2(example));
   AOC_EXPECT_RESULT(344771884978261, solve_case2(input));
 
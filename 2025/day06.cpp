@@ -77,13 +77,13 @@ fn solve_case2(CharGrid const& char_grid) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day06.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day06.example"));
   AOC_EXPECT_RESULT(4277556, solve_case1(example));
-  let input = parse("day06.input");
+  let input = AOC_TIMED_PARSE(parse("day06.input"));
   AOC_EXPECT_RESULT(5322004718681, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(3263827, solve_case2(example));
   AOC_EXPECT_RESULT(9876636978528, solve_case2(input));
 
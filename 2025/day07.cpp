@@ -54,15 +54,15 @@ fn solve_case(Input const& input) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day07.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day07.example"));
   AOC_EXPECT_RESULT(21, solve_case<false>(example));
-  let example2 = parse("day07.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day07.example2"));
   AOC_EXPECT_RESULT(16, solve_case<false>(example2));
-  let input = parse("day07.input");
+  let input = AOC_TIMED_PARSE(parse("day07.input"));
   AOC_EXPECT_RESULT(1560, solve_case<false>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(40, solve_case<true>(example));
   AOC_EXPECT_RESULT(26, solve_case<true>(example2));
   AOC_EXPECT_RESULT(25592971184998, solve_case<true>(input));
@@ -14,10 +14,17 @@
 using Boxes = Vec<std::array<i64, 3>>;
 constexpr let usize_max = std::numeric_limits<usize>::max();
 
-auto parse(String const& filename) -> Boxes {
-  return aoc::views::read_lines(filename) |
+// One pass over the lines as they are read,
+// the scaled inputs are never held in memory whole
+auto parse(String const& filename,
+           usize block_size = aoc::chunked_reader::default_block_size)
+    -> Boxes {
+  auto reader = aoc::chunked_reader{filename, block_size};
+  return reader.lines() |
          stdv::transform(
-             [](str line) { return aoc::split_to_array<3, i64>(line, ','); }) |
+             [](str line) {
+               return aoc::parse_all_integers<std::array<i64, 3>>(line);
+             }) |
          aoc::ranges::to<Boxes>();
 }
 
@@ -90,13 +97,28 @@ fn solve_case(Boxes const& boxes) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day08.example");
+  if (let scaled = aoc::harness::scaled_input()) {
+    let input = AOC_TIMED_PARSE(parse(*scaled));
+    AOC_PART(1);
+    AOC_SCALED_RESULT(solve_case<1000>(input));
+    AOC_PART(2);
+    AOC_SCALED_RESULT(solve_case<usize_max>(input));
+    AOC_RETURN_CHECK_RESULT();
+  }
+
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day08.example"));
   AOC_EXPECT_RESULT(40, solve_case<10>(example));
-  let input = parse("day08.input");
+  // Blocks shorter than the lines: every line is cut by the end of a block,
+  // and the buffer has to grow to hold one
+  AOC_EXPECT_RESULT(40, solve_case<10>(parse("day08.example", 4)));
+  // Blank and padded lines, "\r\n", and no '\n' after the last line
+  let example2 = AOC_TIMED_PARSE(parse("day08.example2", 4));
+  AOC_EXPECT_RESULT(40, solve_case<10>(example2));
+  let input = AOC_TIMED_PARSE(parse("day08.input"));
   AOC_EXPECT_RESULT(102816, solve_case<1000>(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(25272, solve_case<usize_max>(example));
   AOC_EXPECT_RESULT(100011612, solve_case<usize_max>(input));
 
@@ -147,13 +147,13 @@ fn solve_case2(Polygon const& polygon) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day09.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day09.example"));
   AOC_EXPECT_RESULT(50, solve_case1(example));
-  let input = parse("day09.input");
+  let input = AOC_TIMED_PARSE(parse("day09.input"));
   AOC_EXPECT_RESULT(4744899849, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(24, solve_case2(example));
   AOC_EXPECT_RESULT(1540192500, solve_case2(input));
 
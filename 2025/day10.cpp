@@ -145,13 +145,13 @@ fn solve_case2(Input const& input) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day10.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day10.example"));
   AOC_EXPECT_RESULT(7, solve_case1(example));
-  let input = parse("day10.input");
+  let input = AOC_TIMED_PARSE(parse("day10.input"));
   AOC_EXPECT_RESULT(535, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(33, solve_case2(example));
   aoc::return_incomplete();
   // Dijkstra is too slow for part 2 :(
@@ -10,7 +10,8 @@
 #include <set>
 #endif
 
-using Outputs = aoc::static_vector<usize, 20>;
+// Sized for the inputs, a device with more outputs spills to the heap
+using Outputs = aoc::small_vector<usize, 20>;
 using Input = std::pair<Vec<Outputs>, aoc::name_to_id>;
 
 auto parse(String const& filename) -> Input {
@@ -65,15 +66,18 @@ fn solve_case2(Input const& input) -> u64 {
 }
 
 int main() {
-  std::println("Part 1");
-  let example = parse("day11.example");
+  AOC_PART(1);
+  let example = AOC_TIMED_PARSE(parse("day11.example"));
   AOC_EXPECT_RESULT(5, solve_case1(example));
-  let example2 = parse("day11.example2");
+  let example2 = AOC_TIMED_PARSE(parse("day11.example2"));
   AOC_EXPECT_RESULT(8, solve_case1(example2));
-  let input = parse("day11.input");
+  // One device with more outputs than fit inline, next to ones that fit
+  let example3 = AOC_TIMED_PARSE(parse("day11.example3"));
+  AOC_EXPECT_RESULT(27, solve_case1(example3));
+  let input = AOC_CACHED_PARSE(parse, "day11.input");
   AOC_EXPECT_RESULT(523, solve_case1(input));
 
-  std::println("Part 2");
+  AOC_PART(2);
   AOC_EXPECT_RESULT(2, solve_case2(example2));
   AOC_EXPECT_RESULT(517315308154944, solve_case2(input));
 
@@ -62,8 +62,8 @@ fn solve_case1(Input const& input) -> usize {
 }
 
 int main() {
-  std::println("Part 1");
-  let input = parse("day12.input");
+  AOC_PART(1);
+  let input = AOC_TIMED_PARSE(parse("day12.input"));
   AOC_EXPECT_RESULT(510, solve_case1(input));
 
   AOC_RETURN_CHECK_RESULT();
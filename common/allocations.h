@@ -0,0 +1,208 @@
+#ifndef AOC_ALLOCATIONS_H
+#define AOC_ALLOCATIONS_H
+
+// Heap allocation accounting, opt in with AOC_TRACK_ALLOCATIONS.
+//
+// Replaces the global operator new and delete with counting versions
+// on top of malloc, so AOC_EXPECT_RESULT can report how much a solve
+// allocated next to how long it took.
+//
+// Not part of the module: replacement allocation functions
+// have to be defined exactly once in the program, at global scope.
+// Every test is a single translation unit including common.h,
+// which is the only place this is ever included from.
+//
+// Without AOC_TRACK_ALLOCATIONS nothing is replaced
+// and every allocation_scope reads as empty.
+
+#include "compiler.h"
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace aoc {
+
+#ifdef AOC_TRACK_ALLOCATIONS
+inline constexpr bool allocation_tracking = true;
+#else
+inline constexpr bool allocation_tracking = false;
+#endif
+
+struct allocation_stats {
+  std::uint64_t allocations = 0;
+  std::uint64_t bytes = 0;
+  // Highest amount of memory live at once, above what was live at the start
+  std::uint64_t peak_bytes = 0;
+};
+
+namespace detail {
+
+// Relaxed everywhere, the days running threads only need the totals right
+struct allocation_counters {
+  std::atomic<std::uint64_t> allocations = 0;
+  std::atomic<std::uint64_t> bytes = 0;
+  std::atomic<std::uint64_t> live_bytes = 0;
+  std::atomic<std::uint64_t> peak_live_bytes = 0;
+
+  void allocated(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    const auto live =
+        live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+    while ((live > peak) &&
+           !peak_live_bytes.compare_exchange_weak(peak, live,
+                                                  std::memory_order_relaxed)) {
+    }
+  }
+
+  void deallocated(std::size_t size) {
+    live_bytes.fetch_sub(size, std::memory_order_relaxed);
+  }
+};
+
+// Constant initialized, so it is ready for allocations made before main
+inline constinit allocation_counters g_allocation_counters{};
+
+} // namespace detail
+
+/**
+ * Counts the allocations made between construction and stats().
+ *
+ * The peak is global, so it assumes one scope at a time:
+ * opening a scope restarts the peak from whatever is live at that point.
+ */
+class allocation_scope {
+ public:
+  allocation_scope() {
+    auto& counters = detail::g_allocation_counters;
+    allocations_ = counters.allocations.load(std::memory_order_relaxed);
+    bytes_ = counters.bytes.load(std::memory_order_relaxed);
+    live_bytes_ = counters.live_bytes.load(std::memory_order_relaxed);
+    counters.peak_live_bytes.store(live_bytes_, std::memory_order_relaxed);
+  }
+
+  allocation_stats stats() const {
+    const auto& counters = detail::g_allocation_counters;
+    const auto peak = counters.peak_live_bytes.load(std::memory_order_relaxed);
+    return {
+        .allocations =
+            counters.allocations.load(std::memory_order_relaxed) - allocations_,
+        .bytes = counters.bytes.load(std::memory_order_relaxed) - bytes_,
+        .peak_bytes = std::max(peak, live_bytes_) - live_bytes_,
+    };
+  }
+
+ private:
+  std::uint64_t allocations_ = 0;
+  std::uint64_t bytes_ = 0;
+  std::uint64_t live_bytes_ = 0;
+};
+
+namespace detail {
+
+// Sits right in front of every block handed out,
+// delete is not guaranteed to be told the size
+struct allocation_header {
+  void* block;
+  std::size_t size;
+};
+
+inline void* tracked_allocate(std::size_t size, std::size_t alignment) {
+  alignment = std::max(alignment, alignof(allocation_header));
+  const auto total = size + sizeof(allocation_header) + alignment;
+  void* block = std::malloc(total);
+  if (block == nullptr) {
+    return nullptr;
+  }
+  auto address = reinterpret_cast<std::uintptr_t>(block) +
+                 sizeof(allocation_header);
+  address = (address + alignment - 1) & ~(std::uintptr_t{alignment} - 1);
+  auto* header = reinterpret_cast<allocation_header*>(address) - 1;
+  *header = {block, size};
+  g_allocation_counters.allocated(size);
+  return reinterpret_cast<void*>(address);
+}
+
+inline void tracked_deallocate(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  const auto* header = static_cast<allocation_header*>(ptr) - 1;
+  g_allocation_counters.deallocated(header->size);
+  std::free(header->block);
+}
+
+inline void* tracked_new(std::size_t size, std::size_t alignment) {
+  // operator new has to hand out a unique pointer even for zero bytes
+  size = std::max<std::size_t>(size, 1);
+  while (true) {
+    if (void* ptr = tracked_allocate(size, alignment)) {
+      return ptr;
+    }
+    const auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc{};
+    }
+    handler();
+  }
+}
+
+} // namespace detail
+
+} // namespace aoc
+
+// The runner includes this once per day,
+// only its own translation unit gets to define the replacements
+#if defined(AOC_TRACK_ALLOCATIONS) && !defined(AOC_RUNNER_DAY)
+
+// The nothrow forms are left alone,
+// by default they forward to the ones replaced here.
+
+void* operator new(std::size_t size) {
+  return aoc::detail::tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new[](std::size_t size) {
+  return aoc::detail::tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return aoc::detail::tracked_new(size, static_cast<std::size_t>(alignment));
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return aoc::detail::tracked_new(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete[](void* ptr) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete[](void* ptr, std::size_t) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+  aoc::detail::tracked_deallocate(ptr);
+}
+
+#endif // AOC_TRACK_ALLOCATIONS && !AOC_RUNNER_DAY
+
+#endif // AOC_ALLOCATIONS_H
@@ -0,0 +1,121 @@
+#ifndef AOC_BENCHMARK_H
+#define AOC_BENCHMARK_H
+
+#include "compiler.h"
+#include "timer.h"
+
+#ifndef AOC_MODULE_SUPPORT
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#endif
+#endif
+
+AOC_EXPORT_NAMESPACE(aoc) {
+
+struct benchmark_config {
+  // Runs thrown away before measuring,
+  // they fault in the pages and warm the caches and the branch predictors
+  int warmup = 1;
+  int repetitions = 10;
+};
+
+/// Summary of repeated timings, all in nanoseconds.
+struct benchmark_stats {
+  std::size_t runs = 0;
+  std::int64_t min_ns = 0;
+  std::int64_t median_ns = 0;
+  std::int64_t p95_ns = 0;
+  double mean_ns = 0;
+  double stddev_ns = 0;
+};
+
+namespace detail {
+
+// Nearest-rank percentile: the smallest sample
+// that at least `percent` of all samples are less than or equal to
+constexpr std::size_t nearest_rank(std::size_t num_samples,
+                                   std::size_t percent) {
+  return std::max<std::size_t>((num_samples * percent + 99) / 100, 1) - 1;
+}
+static_assert(0 == nearest_rank(1, 95));
+static_assert(9 == nearest_rank(10, 95));
+static_assert(4 == nearest_rank(10, 50));
+static_assert(94 == nearest_rank(100, 95));
+
+} // namespace detail
+
+inline benchmark_stats summarize_samples(std::vector<std::int64_t> samples_ns) {
+  auto stats = benchmark_stats{.runs = samples_ns.size()};
+  if (samples_ns.empty()) {
+    return stats;
+  }
+  std::ranges::sort(samples_ns);
+  stats.min_ns = samples_ns.front();
+  stats.median_ns = samples_ns[detail::nearest_rank(samples_ns.size(), 50)];
+  stats.p95_ns = samples_ns[detail::nearest_rank(samples_ns.size(), 95)];
+
+  double sum = 0;
+  for (const auto sample : samples_ns) {
+    sum += static_cast<double>(sample);
+  }
+  stats.mean_ns = sum / static_cast<double>(samples_ns.size());
+  if (samples_ns.size() > 1) {
+    double squares = 0;
+    for (const auto sample : samples_ns) {
+      const auto diff = static_cast<double>(sample) - stats.mean_ns;
+      squares += diff * diff;
+    }
+    // Sample standard deviation, the runs are a sample of all possible runs
+    stats.stddev_ns =
+        std::sqrt(squares / static_cast<double>(samples_ns.size() - 1));
+  }
+  return stats;
+}
+
+/**
+ * Calls f repeatedly and times every call on its own.
+ *
+ * Returns the result of the last call together with the timing summary.
+ * The previous result is destroyed before the clock starts,
+ * so its deallocation is not charged to the next run.
+ *
+ * f must return the same thing every time it is called -
+ * anything that mutates its input cannot be benchmarked this way.
+ */
+template <std::invocable F>
+  requires(!std::is_void_v<std::invoke_result_t<F&>>)
+auto benchmark(F&& f, const benchmark_config& config = {}) {
+  using result_t = std::remove_cvref_t<std::invoke_result_t<F&>>;
+
+  for (int i = 0; i < config.warmup; ++i) {
+    [[maybe_unused]] const auto discarded = std::invoke(f);
+  }
+
+  const auto repetitions = std::max(config.repetitions, 1);
+  auto samples_ns = std::vector<std::int64_t>{};
+  samples_ns.reserve(static_cast<std::size_t>(repetitions));
+  auto result = std::optional<result_t>{};
+  auto run_timer = timer{};
+  for (int i = 0; i < repetitions; ++i) {
+    result.reset();
+    run_timer.start();
+    result.emplace(std::invoke(f));
+    run_timer.stop();
+    samples_ns.push_back(run_timer.nanoseconds());
+  }
+  return std::pair{std::move(*result),
+                   summarize_samples(std::move(samples_ns))};
+}
+
+} // AOC_EXPORT_NAMESPACE(aoc)
+
+#endif // AOC_BENCHMARK_H
@@ -0,0 +1,195 @@
+#ifndef AOC_CHUNKED_READER_H
+#define AOC_CHUNKED_READER_H
+
+#include "compiler.h"
+#include "concepts.h"
+#include "scan.h"
+#include "string.h"
+
+#ifndef AOC_MODULE_SUPPORT
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+#endif
+#endif
+
+AOC_EXPORT_NAMESPACE(aoc) {
+
+/**
+ * Reads a file one block at a time and hands out its lines.
+ *
+ * Only one block is ever in memory, however big the file:
+ * a line cut by the end of a block is moved to the front of the buffer
+ * and completed by the next read.
+ * The buffer only grows for a line longer than itself,
+ * so the peak is the block size or the longest line, whichever is larger.
+ *
+ * Lines are the same as getline gives, a last line without '\n' included.
+ * Each one points into the buffer and is valid until the next line is read,
+ * copy what has to outlive it.
+ * Like read_file, a file that cannot be opened reads as empty.
+ *
+ * @code
+ * auto input = aoc::chunked_reader{filename};
+ * for (std::string_view line : input.lines()) {
+ *   // consumed in one pass, the input can be larger than the memory
+ * }
+ * @endcode
+ */
+class chunked_reader {
+ public:
+  static constexpr std::size_t default_block_size = 64 * 1024;
+
+  explicit chunked_reader(const std::string& filename,
+                          std::size_t block_size = default_block_size)
+      // Binary, the '\r' of "\r\n" is trimmed along with the other whitespace
+      : m_file{filename, std::ios::binary},
+        m_buffer(std::ranges::max(block_size, std::size_t{1})) {}
+
+  /// Untrimmed, and empty lines included
+  [[nodiscard]] std::optional<std::string_view> next_line() {
+    while (m_newlines == std::default_sentinel) {
+      if (!refill()) {
+        if (m_next == m_end) {
+          return std::nullopt;
+        }
+        const auto last = view(m_next, m_end);
+        m_next = m_end;
+        return last;
+      }
+    }
+    const auto end = m_scanned + *m_newlines;
+    ++m_newlines;
+    const auto line = view(m_next, end);
+    m_next = end + 1;
+    return line;
+  }
+
+  /**
+   * The remaining lines, trimmed and filtered like views::read_lines.
+   *
+   * Takes the same keep_empty and keep_spaces tags.
+   * A single pass: the lines are read off the file as it is iterated.
+   */
+  template <class... Args>
+  [[nodiscard]] auto lines(Args...) & {
+    return lines_view<contains_uncvref<keep_spaces, Args...>,
+                      contains_uncvref<keep_empty, Args...>>{*this};
+  }
+  // The lines would outlive the reader
+  template <class... Args>
+  auto lines(Args...) && = delete;
+
+  /// What the reader holds on to, for checking it stays bounded
+  [[nodiscard]] std::size_t buffer_size() const noexcept {
+    return m_buffer.size();
+  }
+
+ private:
+  template <bool keep_spaces, bool keep_empty_lines>
+  class lines_view
+      : public std::ranges::view_interface<
+            lines_view<keep_spaces, keep_empty_lines>> {
+   public:
+    class iterator {
+     public:
+      using value_type = std::string_view;
+      using difference_type = std::ptrdiff_t;
+
+      iterator() = default;
+      explicit iterator(chunked_reader& reader) : m_reader{&reader} {
+        advance();
+      }
+
+      std::string_view operator*() const { return m_line; }
+      iterator& operator++() {
+        advance();
+        return *this;
+      }
+      void operator++(int) { advance(); }
+      bool operator==(std::default_sentinel_t) const {
+        return m_reader == nullptr;
+      }
+
+     private:
+      void advance() {
+        while (const auto line = m_reader->next_line()) {
+          if (keep_empty_lines || !line->empty()) {
+            m_line = detail::trim_whitespace<keep_spaces>(*line);
+            return;
+          }
+        }
+        m_reader = nullptr;
+      }
+
+      chunked_reader* m_reader = nullptr;
+      std::string_view m_line;
+    };
+
+    lines_view() = default;
+    explicit lines_view(chunked_reader& reader) : m_reader{&reader} {}
+
+    iterator begin() const { return iterator{*m_reader}; }
+    std::default_sentinel_t end() const { return {}; }
+
+   private:
+    chunked_reader* m_reader = nullptr;
+  };
+
+  std::string_view view(std::size_t begin, std::size_t end) const {
+    return {m_buffer.data() + begin, end - begin};
+  }
+
+  bool refill() {
+    // A short read already hit the end of the file, or it never opened
+    if (!m_file) {
+      return false;
+    }
+    // The start of a line cut by the end of the block goes to the front.
+    // Copying forward is fine while the front is ahead of that line,
+    // at m_next == 0 it would copy onto itself, which copy doesn't allow.
+    if (m_next > 0) {
+      std::ranges::copy(m_buffer.begin() + m_next, m_buffer.begin() + m_end,
+                        m_buffer.begin());
+      m_end -= m_next;
+      m_next = 0;
+    }
+    if (m_end == m_buffer.size()) {
+      // The only way the buffer grows, for a line longer than it
+      m_buffer.resize(m_buffer.size() * 2);
+    }
+    m_file.read(m_buffer.data() + m_end,
+                static_cast<std::streamsize>(m_buffer.size() - m_end));
+    const auto num_read = static_cast<std::size_t>(m_file.gcount());
+    if (num_read == 0) {
+      return false;
+    }
+    // The carried over part has no '\n', only what was just read is scanned
+    m_scanned = m_end;
+    m_end += num_read;
+    m_newlines = char_positions_view{view(m_scanned, m_end), '\n'}.begin();
+    return true;
+  }
+
+  std::ifstream m_file;
+  // Not a string, a moved string may move its characters out from under
+  // the lines handed out
+  std::vector<char> m_buffer;
+  // Unread lines are in [m_next, m_end) of the buffer
+  std::size_t m_next = 0;
+  std::size_t m_end = 0;
+  // Where the newlines of the last read start, they are relative to it
+  std::size_t m_scanned = 0;
+  char_positions_view::iterator m_newlines;
+};
+
+} // AOC_EXPORT_NAMESPACE(aoc)
+
+#endif // AOC_CHUNKED_READER_H
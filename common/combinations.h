@@ -264,9 +264,9 @@ combinations_view(ElementsR&&, combinations_args<counter_type>)
  *                         .all_min = 0, .all_max = num_elements}
  *       provides essentially the same functionality, but it's much slower.
  *
- * NOTE: We have to return pointers instead of references (or wrappers)
- *       because `static_vector` requires types to be default constructible,
- *       which can't be easily changed in C++23.
+ * NOTE: We return pointers instead of references (or wrappers)
+ *       because `static_vector` is only usable at compile time
+ *       for default constructible types, which wrappers are not.
  *       This needs to be revisited with C++26 and inplace_vector.
  */
 template <std::ranges::forward_range R,
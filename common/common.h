@@ -32,6 +32,13 @@ import std;
 // that includes a good part of the standard library,
 // so it has to be hoisted here out of hash.h.
 #include <ankerl/unordered_dense.h>
+// Same for the intrinsics of scan.h
+#ifdef AOC_ARCH_X86_64
+#include <immintrin.h>
+#ifdef AOC_COMPILER_MSVC
+#include <intrin.h>
+#endif
+#endif
 // The aoc headers below skip their own std includes, so this has to come first
 import std;
 
@@ -40,7 +47,9 @@ import std;
 // Include same headers as the module
 #include "algorithm.h"
 #include "assert.h"
+#include "benchmark.h"
 #include "bitmap_set.h"
+#include "chunked_reader.h"
 #include "combinations.h"
 #include "compiler.h"
 #include "concepts.h"
@@ -56,6 +65,8 @@ import std;
 #include "range_to.h"
 #include "ranges.h"
 #include "ratio.h"
+#include "scan.h"
+#include "small_vector.h"
 #include "static_vector.h"
 #include "string.h"
 #include "timer.h"
@@ -69,30 +80,53 @@ import std;
 
 #endif // modules
 
+// Not part of the module either, see the headers for why
+#include "allocations.h"
+#include "mapped_file.h"
+#include "memory_usage.h"
+#include "harness.h"
+#include "parse_cache.h"
+#include "perf_counters.h"
+#include "trace.h"
+
 namespace stdr = std::ranges;
 namespace stdv = std::views;
 using point = aoc::point_type<int>;
 
-static bool g_success = true;
+// Unused in the tools, which share this header with the tests
+[[maybe_unused]] static bool g_success = true;
+
+// Set per target by add_sample, they label the records the harness writes
+#ifndef AOC_YEAR
+#define AOC_YEAR 0
+#endif
+#ifndef AOC_DAY
+#define AOC_DAY ""
+#endif
+
+#define AOC_PART(number) aoc::harness::begin_part(number)
+
+/// Evaluates to the expression, with the time it took charged to parsing
+#define AOC_TIMED_PARSE(...)                                                   \
+  aoc::harness::timed_parse([&]() { return (__VA_ARGS__); })
 
 #define AOC_EXPECT_RESULT(expected, actual)                                    \
   {                                                                            \
     constexpr auto expected_v = (expected);                                    \
-    aoc::timer timer_;                                                         \
-    timer_.start();                                                            \
-    const auto actual_v = (actual);                                            \
-    timer_.stop();                                                             \
-    if (expected_v != actual_v) {                                              \
-      std::println("  FAIL {} ms: expected {}, got {}", timer_.milliseconds(), \
-                   expected_v, actual_v);                                      \
+    if (!aoc::harness::expect_result({AOC_YEAR, AOC_DAY}, #actual,             \
+                                     expected_v,                               \
+                                     [&]() { return (actual); })) {            \
       g_success = false;                                                       \
-    } else {                                                                   \
-      std::println("  OK {} ms", timer_.milliseconds());                       \
     }                                                                          \
     aoc::flush();                                                              \
   }
 
+/// Solves without checking, for the generated inputs of tools/scaled/
+#define AOC_SCALED_RESULT(actual)                                              \
+  AOC_EXPECT_RESULT(aoc::harness::unchecked, actual)
+
 #define AOC_RETURN_CHECK_RESULT()                                              \
+  aoc::harness::print_summary();                                               \
   if (g_success) {                                                             \
     return 0;                                                                  \
   } else {                                                                     \
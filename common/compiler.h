@@ -40,6 +40,10 @@
 #endif
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define AOC_ARCH_X86_64
+#endif
+
 #ifndef AOC_SKIP_RETURN_CODE
 #define AOC_SKIP_RETURN_CODE 17
 #endif
@@ -61,6 +65,24 @@
 #define AOC_FORCE_INLINE
 #endif
 
+#ifdef AOC_COMPILER_MSVC
+#define AOC_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define AOC_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+/// Starts loading the cache line of an address that is read soon.
+/// Only a hint, it never faults.
+/// MSVC needs <intrin.h> for it, included by the headers that use it.
+#if defined(AOC_COMPILER_MSVC) && defined(AOC_ARCH_X86_64)
+#define AOC_PREFETCH(address)                                                  \
+  _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#elif defined(AOC_COMPILER_MSVC)
+#define AOC_PREFETCH(address) ((void)(address))
+#else
+#define AOC_PREFETCH(address) __builtin_prefetch(address)
+#endif
+
 #ifdef AOC_COMPILER_CLANG
 #define AOC_NO_SANITIZE_WRAPAROUND                                             \
   [[clang::no_sanitize("unsigned-integer-overflow", "unsigned-shift-base")]]
@@ -3,6 +3,7 @@
 
 #include "compiler.h"
 #include "concepts.h"
+#include "flat.h"
 #include "functional.h"
 #include "hash.h"
 #include "range_to.h"
@@ -131,6 +132,39 @@ using predecessor_map = default_map<Node, std::remove_cvref_t<Node>>;
 template <class Node>
 using predecessor_map_all = default_map<Node, default_set<Node>>;
 
+/// For passing search_stats without predecessors,
+/// a plain nullptr leaves nothing to deduce the map type from
+template <class Node>
+inline constexpr predecessor_map<Node>* no_predecessors = nullptr;
+
+/**
+ * What a search did, filled in through the optional stats_out parameter.
+ *
+ * Running the same search with and without its heuristic
+ * shows how much the heuristic prunes: nodes_expanded drops with it.
+ * start_heuristic against the distance found shows how tight it is,
+ * an admissible heuristic never exceeds that distance.
+ */
+struct search_stats {
+  // Popped and had their neighbors looked at
+  std::size_t nodes_expanded = 0;
+  // Popped after a shorter distance to them had already been found
+  std::size_t stale_pops = 0;
+  std::size_t heap_pushes = 0;
+  std::size_t peak_heap_size = 0;
+  std::size_t peak_distances_size = 0;
+  // Heuristic of the best start node, zero for plain Dijkstra
+  long long start_heuristic = 0;
+  // Summed over the expanded nodes
+  long long heuristic_sum = 0;
+
+  constexpr double mean_heuristic() const {
+    return (nodes_expanded > 0) ? static_cast<double>(heuristic_sum) /
+                                      static_cast<double>(nodes_expanded)
+                                : 0.0;
+  }
+};
+
 // https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm#Algorithm
 // https://en.wikipedia.org/wiki/A*_search_algorithm
 // Dijkstra is A* with a zero heuristic (constant_value<int>{}).
@@ -152,7 +186,8 @@ template <class ReturnT = void, class Node, class NeighborsFn,
 constexpr auto shortest_distances_dijkstra(
     std::span<const Node> start_nodes, EndReachedFn&& end_reached,
     NeighborsFn&& get_reachable_neighbors, HeuristicFn&& heuristic = {},
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using distances_t = std::conditional_t<std::is_void_v<ReturnT>,
                                          default_map<Node, int>, ReturnT>;
 
@@ -183,6 +218,24 @@ constexpr auto shortest_distances_dijkstra(
     unvisited.emplace(static_cast<int>(heuristic(node)), 0, node);
   }
 
+  if (stats_out != nullptr) {
+    *stats_out = {};
+    if (!unvisited.empty()) {
+      stats_out->start_heuristic = std::get<0>(unvisited.top());
+    }
+  }
+  const auto record_push = [&] {
+    if (stats_out != nullptr) {
+      ++stats_out->heap_pushes;
+      stats_out->peak_heap_size =
+          std::max(stats_out->peak_heap_size, unvisited.size());
+    }
+  };
+  if (stats_out != nullptr) {
+    stats_out->heap_pushes = unvisited.size();
+    stats_out->peak_heap_size = unvisited.size();
+  }
+
   while (!unvisited.empty()) {
     // 3. From the unvisited set, select the current node to be the one
     // with the smallest (finite) distance
@@ -191,6 +244,9 @@ constexpr auto shortest_distances_dijkstra(
 
     // Skip stale entries — a better g was found after this was enqueued
     if (distances.find(current)->second < g_enqueued) {
+      if (stats_out != nullptr) {
+        ++stats_out->stale_pops;
+      }
       continue;
     }
 
@@ -199,6 +255,10 @@ constexpr auto shortest_distances_dijkstra(
     if (end_reached(current)) {
       break;
     }
+    if (stats_out != nullptr) {
+      ++stats_out->nodes_expanded;
+      stats_out->heuristic_sum += f - g_enqueued;
+    }
 
     // 4. For the current node, consider all of its unvisited neighbors
     // and update their distances through the current node
@@ -219,6 +279,7 @@ constexpr auto shortest_distances_dijkstra(
           const int f_new =
               tentative_g + static_cast<int>(heuristic(neighbor.node));
           unvisited.emplace(f_new, tentative_g, neighbor.node);
+          record_push();
           if constexpr (!all_predecessors) {
             if (use_predecessors) {
               (*predecessors_out)[neighbor.node] = current;
@@ -235,6 +296,7 @@ constexpr auto shortest_distances_dijkstra(
         const int f_new =
             tentative_g + static_cast<int>(heuristic(neighbor.node));
         unvisited.emplace(f_new, tentative_g, neighbor.node);
+        record_push();
         if (use_predecessors) {
           if constexpr (all_predecessors) {
             (*predecessors_out)[neighbor.node].emplace(current);
@@ -246,6 +308,10 @@ constexpr auto shortest_distances_dijkstra(
     }
   }
 
+  if (stats_out != nullptr) {
+    // Nothing is ever removed from it
+    stats_out->peak_distances_size = distances.size();
+  }
   return distances;
 }
 
@@ -255,27 +321,45 @@ constexpr auto shortest_distances_dijkstra(
 /// and get_backward_neighbors walks reverse edges.
 /// Both neighbor ranges use dijkstra_neighbor_t<Node> costs.
 /// Heuristics must be admissible in their respective directions.
-template <class Node, class ForwardNeighborsFn, class BackwardNeighborsFn,
+/// stats_out counts both directions together,
+/// start_heuristic is the forward one.
+/// The nodes are taken by value, there is no separate forwarding overload:
+/// with the same parameters it would be ambiguous with this one for any call.
+/// DistancesMap is used for both directions, void picks default_map.
+template <class DistancesMap = void, class Node, class ForwardNeighborsFn,
+          class BackwardNeighborsFn,
           class ForwardHeuristicFn = constant_value<int>,
           class BackwardHeuristicFn = constant_value<int>>
-  requires std::totally_ordered<Node> && requires(Node node) {
-    { std::declval<ForwardHeuristicFn>()(node) } -> std::convertible_to<int>;
-    { std::declval<BackwardHeuristicFn>()(node) } -> std::convertible_to<int>;
-  }
+  requires std::totally_ordered<Node> &&
+           requires(Node node) {
+             {
+               std::declval<ForwardHeuristicFn>()(node)
+             } -> std::convertible_to<int>;
+             {
+               std::declval<BackwardHeuristicFn>()(node)
+             } -> std::convertible_to<int>;
+           } &&
+           (std::is_void_v<DistancesMap> || distances_map<DistancesMap, Node>)
 constexpr std::optional<int> shortest_distance_bidirectional_astar(
     Node start_node, Node end_node, ForwardNeighborsFn&& get_forward_neighbors,
     BackwardNeighborsFn&& get_backward_neighbors,
     ForwardHeuristicFn&& forward_heuristic = {},
-    BackwardHeuristicFn&& backward_heuristic = {}) {
+    BackwardHeuristicFn&& backward_heuristic = {},
+    search_stats* stats_out = nullptr) {
+  if (stats_out != nullptr) {
+    *stats_out = {};
+  }
   if (start_node == end_node) {
     return 0;
   }
 
+  using distances_t = std::conditional_t<std::is_void_v<DistancesMap>,
+                                         default_map<Node, int>, DistancesMap>;
   using entry_t = std::tuple<int, int, Node>;
   auto forward_unvisited = priority_queue<entry_t, std::greater<entry_t>>{};
   auto backward_unvisited = priority_queue<entry_t, std::greater<entry_t>>{};
-  auto forward_distances = default_map<Node, int>{};
-  auto backward_distances = default_map<Node, int>{};
+  auto forward_distances = distances_t{};
+  auto backward_distances = distances_t{};
 
   forward_distances.emplace(start_node, 0);
   backward_distances.emplace(end_node, 0);
@@ -283,24 +367,36 @@ constexpr std::optional<int> shortest_distance_bidirectional_astar(
                             start_node);
   backward_unvisited.emplace(static_cast<int>(backward_heuristic(end_node)), 0,
                              end_node);
+  if (stats_out != nullptr) {
+    stats_out->start_heuristic = std::get<0>(forward_unvisited.top());
+    stats_out->heap_pushes = 2;
+    stats_out->peak_heap_size = 2;
+  }
 
   auto best_distance = std::optional<int>{};
 
-  auto remove_stale = [](auto& unvisited, const auto& distances) {
+  auto remove_stale = [&](auto& unvisited, const auto& distances) {
     while (!unvisited.empty()) {
       const auto& [_, g_enqueued, current] = unvisited.top();
       if (distances.find(current)->second >= g_enqueued) {
         break;
       }
       unvisited.pop();
+      if (stats_out != nullptr) {
+        ++stats_out->stale_pops;
+      }
     }
   };
 
   auto search_direction = [&](auto& own_unvisited, auto& own_distances,
                               auto& other_distances, auto&& get_neighbors,
                               auto&& heuristic) {
-    auto [_, g_enqueued, current] = own_unvisited.top();
+    auto [f, g_enqueued, current] = own_unvisited.top();
     own_unvisited.pop();
+    if (stats_out != nullptr) {
+      ++stats_out->nodes_expanded;
+      stats_out->heuristic_sum += f - g_enqueued;
+    }
 
     for (const auto& neighbor : get_neighbors(current)) {
       const int tentative_g = g_enqueued + neighbor.distance;
@@ -313,6 +409,12 @@ constexpr std::optional<int> shortest_distance_bidirectional_astar(
       own_unvisited.emplace(
           tentative_g + static_cast<int>(heuristic(neighbor.node)), tentative_g,
           neighbor.node);
+      if (stats_out != nullptr) {
+        ++stats_out->heap_pushes;
+        stats_out->peak_heap_size =
+            std::max(stats_out->peak_heap_size,
+                     forward_unvisited.size() + backward_unvisited.size());
+      }
 
       if (const auto other_it = other_distances.find(neighbor.node);
           other_it != std::end(other_distances)) {
@@ -349,6 +451,10 @@ constexpr std::optional<int> shortest_distance_bidirectional_astar(
     }
   }
 
+  if (stats_out != nullptr) {
+    stats_out->peak_distances_size =
+        forward_distances.size() + backward_distances.size();
+  }
   return best_distance;
 }
 
@@ -382,50 +488,54 @@ template <class ReturnT = void, class Node, class NeighborsFn,
           class PredecessorMap = predecessor_map<Node>>
 constexpr auto shortest_distances_dijkstra(
     Node&& start_node, NeighborsFn&& get_reachable_neighbors,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}}, {},
       std::forward<NeighborsFn>(get_reachable_neighbors), constant_value<int>{},
-      predecessors_out);
+      predecessors_out, stats_out);
 }
 template <class ReturnT = void, class Node, class NeighborsFn,
           class PredecessorMap = predecessor_map<Node>>
 constexpr auto shortest_distances_dijkstra(
     Node&& start_node, Node&& end_node, NeighborsFn&& get_reachable_neighbors,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}},
       equal_to_value{std::forward<Node>(end_node)},
       std::forward<NeighborsFn>(get_reachable_neighbors), constant_value<int>{},
-      predecessors_out);
+      predecessors_out, stats_out);
 }
 template <class ReturnT = void, class Node, class NeighborsFn,
           class PredecessorMap = predecessor_map<Node>>
 constexpr auto shortest_distances_dijkstra(
     Node&& start_node, std::span<std::remove_cvref_t<Node>> end_nodes,
     NeighborsFn&& get_reachable_neighbors,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}},
       all_nodes_encountered{end_nodes},
       std::forward<NeighborsFn>(get_reachable_neighbors), constant_value<int>{},
-      predecessors_out);
+      predecessors_out, stats_out);
 }
 template <class ReturnT = void, class Node, class NeighborsFn,
           class PredecessorMap = predecessor_map<Node>>
 constexpr auto shortest_distances_dijkstra(
     Node&& start_node, std::span<const std::remove_cvref_t<Node>> end_nodes,
     NeighborsFn&& get_reachable_neighbors,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}},
       all_nodes_encountered{end_nodes},
       std::forward<NeighborsFn>(get_reachable_neighbors), constant_value<int>{},
-      predecessors_out);
+      predecessors_out, stats_out);
 }
 template <class ReturnT = void, class Node, class NeighborsFn,
           class EndReachedFn = constant_value<bool>,
@@ -433,13 +543,14 @@ template <class ReturnT = void, class Node, class NeighborsFn,
 constexpr auto shortest_distances_dijkstra(
     Node&& start_node, EndReachedFn&& end_reached,
     NeighborsFn&& get_reachable_neighbors,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}},
       std::forward<EndReachedFn>(end_reached),
       std::forward<NeighborsFn>(get_reachable_neighbors), constant_value<int>{},
-      predecessors_out);
+      predecessors_out, stats_out);
 }
 template <class ReturnT = void, class Node, class NeighborsFn,
           class EndReachedFn = constant_value<bool>,
@@ -448,26 +559,30 @@ template <class ReturnT = void, class Node, class NeighborsFn,
 constexpr auto shortest_distances_dijkstra(
     std::span<Node> start_nodes, EndReachedFn&& end_reached,
     NeighborsFn&& get_reachable_neighbors,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{start_nodes},
       std::forward<EndReachedFn>(end_reached),
       std::forward<NeighborsFn>(get_reachable_neighbors), constant_value<int>{},
-      predecessors_out);
+      predecessors_out, stats_out);
 }
 
-template <class Node, class ForwardNeighborsFn, class BackwardNeighborsFn>
+template <class DistancesMap = void, class Node, class ForwardNeighborsFn,
+          class BackwardNeighborsFn>
 constexpr auto shortest_distance_bidirectional_dijkstra(
     Node&& start_node, Node&& end_node,
     ForwardNeighborsFn&& get_forward_neighbors,
-    BackwardNeighborsFn&& get_backward_neighbors) {
+    BackwardNeighborsFn&& get_backward_neighbors,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
-  return shortest_distance_bidirectional_astar(
+  return shortest_distance_bidirectional_astar<DistancesMap>(
       node_t{std::forward<Node>(start_node)},
       node_t{std::forward<Node>(end_node)},
       std::forward<ForwardNeighborsFn>(get_forward_neighbors),
-      std::forward<BackwardNeighborsFn>(get_backward_neighbors));
+      std::forward<BackwardNeighborsFn>(get_backward_neighbors),
+      constant_value<int>{}, constant_value<int>{}, stats_out);
 }
 
 // A* convenience overloads (caller-supplied heuristic)
@@ -476,13 +591,14 @@ template <class ReturnT = void, class Node, class NeighborsFn,
           class HeuristicFn, class PredecessorMap = predecessor_map<Node>>
 constexpr auto shortest_distances_astar(
     Node&& start_node, Node&& end_node, NeighborsFn&& get_reachable_neighbors,
-    HeuristicFn&& heuristic, PredecessorMap* predecessors_out = nullptr) {
+    HeuristicFn&& heuristic, PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}},
       equal_to_value{std::forward<Node>(end_node)},
       std::forward<NeighborsFn>(get_reachable_neighbors),
-      std::forward<HeuristicFn>(heuristic), predecessors_out);
+      std::forward<HeuristicFn>(heuristic), predecessors_out, stats_out);
 }
 template <class ReturnT = void, class Node, class NeighborsFn,
           class HeuristicFn, class EndReachedFn = constant_value<bool>,
@@ -490,13 +606,14 @@ template <class ReturnT = void, class Node, class NeighborsFn,
 constexpr auto shortest_distances_astar(
     Node&& start_node, EndReachedFn&& end_reached,
     NeighborsFn&& get_reachable_neighbors, HeuristicFn&& heuristic,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{std::array{std::forward<Node>(start_node)}},
       std::forward<EndReachedFn>(end_reached),
       std::forward<NeighborsFn>(get_reachable_neighbors),
-      std::forward<HeuristicFn>(heuristic), predecessors_out);
+      std::forward<HeuristicFn>(heuristic), predecessors_out, stats_out);
 }
 
 template <class ReturnT = void, class Node, class NeighborsFn,
@@ -506,32 +623,104 @@ template <class ReturnT = void, class Node, class NeighborsFn,
 constexpr auto shortest_distances_astar(
     std::span<Node> start_nodes, EndReachedFn&& end_reached,
     NeighborsFn&& get_reachable_neighbors, HeuristicFn&& heuristic,
-    PredecessorMap* predecessors_out = nullptr) {
+    PredecessorMap* predecessors_out = nullptr,
+    search_stats* stats_out = nullptr) {
   using node_t = std::remove_cvref_t<Node>;
   return shortest_distances_dijkstra<ReturnT>(
       std::span<const node_t>{start_nodes},
       std::forward<EndReachedFn>(end_reached),
       std::forward<NeighborsFn>(get_reachable_neighbors),
-      std::forward<HeuristicFn>(heuristic), predecessors_out);
+      std::forward<HeuristicFn>(heuristic), predecessors_out, stats_out);
 }
 
-template <class Node, class ForwardNeighborsFn, class BackwardNeighborsFn,
-          class ForwardHeuristicFn, class BackwardHeuristicFn>
-constexpr auto shortest_distance_bidirectional_astar(
-    Node&& start_node, Node&& end_node,
-    ForwardNeighborsFn&& get_forward_neighbors,
-    BackwardNeighborsFn&& get_backward_neighbors,
-    ForwardHeuristicFn&& forward_heuristic,
-    BackwardHeuristicFn&& backward_heuristic) {
-  using node_t = std::remove_cvref_t<Node>;
-  return shortest_distance_bidirectional_astar(
-      node_t{std::forward<Node>(start_node)},
-      node_t{std::forward<Node>(end_node)},
-      std::forward<ForwardNeighborsFn>(get_forward_neighbors),
-      std::forward<BackwardNeighborsFn>(get_backward_neighbors),
-      std::forward<ForwardHeuristicFn>(forward_heuristic),
-      std::forward<BackwardHeuristicFn>(backward_heuristic));
+namespace detail {
+// The shortest path from 0 to 4 is 0 -> 2 -> 1 -> 3 -> 4, of length 7.
+// Both 1 and 3 are pushed again once the path through 2 reaches them.
+// 5 is a dead end that plain Dijkstra expands before 1 and a heuristic skips.
+inline constexpr auto search_test_edges = std::array<std::array<int, 3>, 9>{{
+    {0, 1, 4},
+    {0, 2, 1},
+    {0, 5, 2},
+    {2, 1, 2},
+    {2, 3, 5},
+    {2, 4, 9},
+    {1, 3, 1},
+    {3, 4, 3},
+    {5, 4, 20},
+}};
+constexpr std::vector<dijkstra_neighbor_t<int>> search_test_forward(int node) {
+  auto neighbors = std::vector<dijkstra_neighbor_t<int>>{};
+  for (const auto& [from, to, distance] : search_test_edges) {
+    if (from == node) {
+      neighbors.push_back({to, distance});
+    }
+  }
+  return neighbors;
+}
+constexpr std::vector<dijkstra_neighbor_t<int>> search_test_backward(int node) {
+  auto neighbors = std::vector<dijkstra_neighbor_t<int>>{};
+  for (const auto& [from, to, distance] : search_test_edges) {
+    if (to == node) {
+      neighbors.push_back({from, distance});
+    }
+  }
+  return neighbors;
 }
+// Exact, so both are admissible
+constexpr int search_test_to_end(int node) {
+  return std::array{7, 4, 6, 3, 0, 20}[node];
+}
+constexpr int search_test_from_start(int node) {
+  return std::array{0, 3, 1, 4, 7, 2}[node];
+}
+} // namespace detail
+
+static_assert([] {
+  auto stats = search_stats{};
+  const auto distances = shortest_distances_dijkstra<flat_map<int, int>>(
+      0, 4, detail::search_test_forward, no_predecessors<int>, &stats);
+  return (distances.at(4) == 7) && (stats.nodes_expanded == 5) &&
+         (stats.stale_pops == 2) && (stats.heap_pushes == 9) &&
+         (stats.peak_heap_size == 5) && (stats.peak_distances_size == 6) &&
+         (stats.start_heuristic == 0) && (stats.heuristic_sum == 0);
+}());
+// The heuristic keeps 5 from being expanded and nothing goes stale
+static_assert([] {
+  auto stats = search_stats{};
+  const auto distances = shortest_distances_astar<flat_map<int, int>>(
+      0, 4, detail::search_test_forward, detail::search_test_to_end,
+      no_predecessors<int>, &stats);
+  return (distances.at(4) == 7) && (stats.nodes_expanded == 4) &&
+         (stats.stale_pops == 0) && (stats.heap_pushes == 9) &&
+         (stats.peak_heap_size == 5) && (stats.peak_distances_size == 6) &&
+         (stats.start_heuristic == 7) && (stats.heuristic_sum == 20);
+}());
+// Both directions count together, each expands most of the graph here
+static_assert([] {
+  auto stats = search_stats{};
+  const auto distance =
+      shortest_distance_bidirectional_dijkstra<flat_map<int, int>>(
+          0, 4, detail::search_test_forward, detail::search_test_backward,
+          &stats);
+  return (distance == 7) && (stats.nodes_expanded == 9) &&
+         (stats.stale_pops == 2) && (stats.heap_pushes == 18) &&
+         (stats.peak_heap_size == 8) &&
+         (stats.peak_distances_size == 12) &&
+         (stats.start_heuristic == 0) && (stats.heuristic_sum == 0);
+}());
+// The two heuristics meet on the shortest path and stop both directions early
+static_assert([] {
+  auto stats = search_stats{};
+  const auto distance =
+      shortest_distance_bidirectional_astar<flat_map<int, int>>(
+          0, 4, detail::search_test_forward, detail::search_test_backward,
+          detail::search_test_to_end, detail::search_test_from_start, &stats);
+  return (distance == 7) && (stats.nodes_expanded == 4) &&
+         (stats.stale_pops == 0) && (stats.heap_pushes == 10) &&
+         (stats.peak_heap_size == 6) &&
+         (stats.peak_distances_size == 7) &&
+         (stats.start_heuristic == 7) && (stats.heuristic_sum == 20);
+}());
 
 template <class Node>
 std::vector<Node> get_path(const predecessor_map<Node>& predecessors,
@@ -556,4 +745,18 @@ struct std::formatter<aoc::dijkstra_neighbor_t<Node>> {
   }
 };
 
+template <>
+struct std::formatter<aoc::search_stats> {
+  constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+  auto format(const aoc::search_stats& stats, std::format_context& ctx) const {
+    return std::format_to(
+        ctx.out(),
+        "{} expanded, {} stale, {} pushed, peak heap {}, peak distances {}, "
+        "start heuristic {}, mean heuristic {:.1f}",
+        stats.nodes_expanded, stats.stale_pops, stats.heap_pushes,
+        stats.peak_heap_size, stats.peak_distances_size, stats.start_heuristic,
+        stats.mean_heuristic());
+  }
+};
+
 #endif // AOC_DIJKSTRA_H
@@ -1,19 +1,31 @@
 #ifndef AOC_FLAT_H
 #define AOC_FLAT_H
 
+#include "assert.h"
 #include "compiler.h"
 #include "concepts.h"
+#include "range_to.h"
 
 #ifndef AOC_MODULE_SUPPORT
+#if defined(AOC_COMPILER_MSVC) && defined(AOC_ARCH_X86_64)
+#include <intrin.h>
+#endif
 #ifndef AOC_IMPORT_STD
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <compare>
 #include <concepts>
+#include <cstddef>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <numeric>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 #endif
@@ -21,11 +33,196 @@
 
 AOC_EXPORT_NAMESPACE(aoc) {
 
+/// Promises a flat container that a range is already sorted and unique,
+/// it is then taken as is, or merged in without sorting it first
+struct sorted_unique_t {
+  explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+
+/**
+ * How a flat container searches its sorted keys, the last template argument
+ * of flat_set and flat_map.
+ *
+ * A layout keeps an index next to the keys, rebuilt on every change,
+ * and answers lower_bound and find as positions in the sorted keys,
+ * find with the size of the keys for a missing key.
+ * The keys themselves, and so iteration, stay sorted whatever the layout.
+ */
+struct sorted_layout {
+  /// Nothing besides the keys, a binary search over them
+  template <class Key, class Compare>
+  class index {
+   public:
+    constexpr void rebuild(std::span<const Key>) {}
+
+    template <class K>
+    constexpr std::size_t lower_bound(std::span<const Key> keys, const K& key,
+                                      const Compare& compare) const {
+      return static_cast<std::size_t>(
+          std::ranges::lower_bound(keys, key, compare) - keys.begin());
+    }
+
+    template <class K>
+    constexpr std::size_t find(std::span<const Key> keys, const K& key,
+                               const Compare& compare) const {
+      const auto position = this->lower_bound(keys, key, compare);
+      if ((position == keys.size()) || (keys[position] == key)) {
+        return position;
+      }
+      return keys.size();
+    }
+  };
+};
+
+/**
+ * A copy of the keys in Eytzinger (breadth first) order:
+ * the children of the key at k are at 2k and 2k+1.
+ *
+ * A binary search then walks down from the front of the array,
+ * the first levels share a few cache lines that stay hot,
+ * and the 16 descendants four levels down are next to each other,
+ * so they are fetched while the levels above are still compared.
+ * Each step is a comparison turned into an index, with no branch to mispredict.
+ * The position in the sorted keys is computed from where the search ends,
+ * find does not touch the sorted keys at all.
+ *
+ * Costs a copy of the keys and a rebuild per change,
+ * for sets and maps built once and then searched a lot,
+ * too large for the cache to hold.
+ *
+ * https://algorithmica.org/en/eytzinger
+ */
+struct eytzinger_layout {
+  template <class Key, class Compare>
+  class index {
+   public:
+    constexpr void rebuild(std::span<const Key> keys) {
+      m_keys.clear();
+      if (keys.empty()) {
+        return;
+      }
+      // 1-based, the front is never read
+      m_keys.assign(keys.size() + 1, keys.front());
+      auto next = std::size_t{0};
+      this->fill(keys, next, 1);
+    }
+
+    template <class K>
+    constexpr std::size_t lower_bound(std::span<const Key> keys, const K& key,
+                                      const Compare& compare) const {
+      const auto k = this->search(key, compare);
+      return (k == 0) ? keys.size() : this->position(k);
+    }
+
+    template <class K>
+    constexpr std::size_t find(std::span<const Key> keys, const K& key,
+                               const Compare& compare) const {
+      const auto k = this->search(key, compare);
+      return ((k == 0) || !(m_keys[k] == key)) ? keys.size()
+                                               : this->position(k);
+    }
+
+   private:
+    // 16 descendants of 4 byte keys are a cache line
+    static constexpr std::size_t prefetch_ahead = 16;
+
+    constexpr std::size_t size() const {
+      return m_keys.empty() ? 0 : m_keys.size() - 1;
+    }
+
+    /// The node of the lower bound, 0 when every key is smaller
+    template <class K>
+    constexpr std::size_t search(const K& key, const Compare& compare) const {
+      const auto size = this->size();
+      auto k = std::size_t{1};
+      while (k <= size) {
+        if (!std::is_constant_evaluated() && (k * prefetch_ahead <= size)) {
+          AOC_PREFETCH(m_keys.data() + k * prefetch_ahead);
+        }
+        k = 2 * k + static_cast<std::size_t>(compare(m_keys[k], key));
+      }
+      // The path went right every time it was smaller since the last left,
+      // undoing those turns and the last left lands on the answer
+      return k >> (std::countr_one(k) + 1);
+    }
+
+    /// Where the node at k is in the sorted keys, its in-order rank.
+    /// Computed rather than stored, a table of them would be another
+    /// cache miss per search.
+    constexpr std::size_t position(std::size_t k) const {
+      const auto size = this->size();
+      const auto height = static_cast<std::size_t>(std::bit_width(size));
+      const auto depth = static_cast<std::size_t>(std::bit_width(k)) - 1;
+      const auto in_level = k - (std::size_t{1} << depth);
+      // Its rank were the last level full,
+      // the nodes of the last level and the rest take turns in order
+      const auto full_rank = ((2 * in_level + 1) << (height - 1 - depth)) - 1;
+      const auto last_level_before = (full_rank + 1) / 2;
+      const auto above_last_level = (std::size_t{1} << (height - 1)) - 1;
+      const auto last_level_size = size - above_last_level;
+      return full_rank - ((last_level_before > last_level_size)
+                              ? (last_level_before - last_level_size)
+                              : 0);
+    }
+
+    // An in-order walk of the implicit tree meets the keys sorted
+    constexpr void fill(std::span<const Key> keys, std::size_t& next,
+                        std::size_t k) {
+      if (k > keys.size()) {
+        return;
+      }
+      this->fill(keys, next, 2 * k);
+      m_keys[k] = keys[next++];
+      this->fill(keys, next, 2 * k + 1);
+    }
+
+    std::vector<Key> m_keys;
+  };
+};
+
+namespace detail {
+
+/// Both layouts give the same positions for n keys,
+/// searched for keys below, between, equal to and above all of them
+constexpr bool eytzinger_matches_sorted(int n) {
+  auto keys = std::vector<int>{};
+  for (int i = 0; i < n; ++i) {
+    keys.push_back(2 * i + 1);
+  }
+  using compare_t = std::ranges::less;
+  auto sorted = sorted_layout::index<int, compare_t>{};
+  auto eytzinger = eytzinger_layout::index<int, compare_t>{};
+  sorted.rebuild(keys);
+  eytzinger.rebuild(keys);
+  for (int key = -1; key <= 2 * n + 1; ++key) {
+    if ((sorted.lower_bound(keys, key, compare_t{}) !=
+         eytzinger.lower_bound(keys, key, compare_t{})) ||
+        (sorted.find(keys, key, compare_t{}) !=
+         eytzinger.find(keys, key, compare_t{}))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace detail
+
+// Every shape of the last level, full and partly filled, up to 6 levels
+static_assert([] {
+  for (int n = 0; n <= 40; ++n) {
+    if (!detail::eytzinger_matches_sorted(n)) {
+      return false;
+    }
+  }
+  return true;
+}());
+
 // Barebones implementation of
 // https://en.cppreference.com/w/cpp/container/flat_set, but with constexpr
 // NOTE: Can be replaced by std::flat_set in C++26
 template <class Key, class Compare = std::ranges::less,
-          class KeyContainer = std::vector<Key>>
+          class KeyContainer = std::vector<Key>, class Layout = sorted_layout>
 class flat_set {
  private:
   // NOTE: This container was designed with support for std::vector only,
@@ -53,12 +250,34 @@ class flat_set {
   constexpr flat_set() : flat_set(key_compare()) {}    // 1
   constexpr explicit flat_set(const key_compare& comp) // 10
       : key_container(), compare(comp) {}
+  constexpr explicit flat_set(container_type cont,
+                              const key_compare& comp = key_compare()) // 2
+      : key_container(std::move(cont)), compare(comp) {
+    this->sort_unique_from(0);
+  }
+  constexpr flat_set(sorted_unique_t, container_type cont,
+                     const key_compare& comp = key_compare()) // 6
+      : key_container(std::move(cont)), compare(comp) {
+    this->reindex();
+  }
   template <class InputIter>
   constexpr flat_set(InputIter first, InputIter last,
                      const key_compare& comp = key_compare()) // 13
       : compare(comp) {
     this->insert(first, last);
   }
+  template <class InputIter>
+  constexpr flat_set(sorted_unique_t, InputIter first, InputIter last,
+                     const key_compare& comp = key_compare()) // 17
+      : key_container(first, last), compare(comp) {
+    this->reindex();
+  }
+  template <std::ranges::input_range R>
+  constexpr flat_set(ranges::from_range_t, R&& range,
+                     const key_compare& comp = key_compare()) // 21
+      : compare(comp) {
+    this->insert_range(std::forward<R>(range));
+  }
   constexpr flat_set(std::initializer_list<value_type> init,
                      const key_compare& comp = key_compare()) // 23
       : flat_set(init.begin(), init.end(), comp) {}
@@ -104,11 +323,32 @@ class flat_set {
     auto [it, inserted] = this->insert_generic(pos, std::move(value));
     return it;
   }
+  /// Appends the whole range, sorts it and merges it in,
+  /// O(m log m + n) instead of an insert shifting the tail per element
   template <class InputIt>
   constexpr void insert(InputIt first, InputIt last) { // 6
-    for (; first != last; ++first) {
-      this->insert(*first);
-    }
+    const auto old_size = this->size();
+    key_container.insert(key_container.end(), first, last);
+    this->sort_unique_from(old_size);
+  }
+  /// O(m + n), the range is merged in as it is
+  template <class InputIt>
+  constexpr void insert(sorted_unique_t, InputIt first, InputIt last) { // 7
+    const auto old_size = this->size();
+    key_container.insert(key_container.end(), first, last);
+    this->merge_unique_from(old_size);
+  }
+  template <std::ranges::input_range R>
+  constexpr void insert_range(R&& range) { // 10
+    const auto old_size = this->size();
+    std::ranges::copy(range, std::back_inserter(key_container));
+    this->sort_unique_from(old_size);
+  }
+  template <std::ranges::input_range R>
+  constexpr void insert_range(sorted_unique_t, R&& range) { // 11
+    const auto old_size = this->size();
+    std::ranges::copy(range, std::back_inserter(key_container));
+    this->merge_unique_from(old_size);
   }
 
   template <class... Args>
@@ -117,13 +357,18 @@ class flat_set {
                                 value_type(std::forward<Args>(args)...));
   }
 
-  constexpr container_type extract() && { return std::move(key_container); }
+  constexpr container_type extract() && {
+    auto extracted = std::move(key_container);
+    this->clear();
+    return extracted;
+  }
 
   /// Preconditions:
   /// 1. The elements of cont must be sorted with respect to compare
   /// 2. cont must not contain equal elements
   constexpr void replace(container_type&& cont) {
     key_container = std::move(cont);
+    this->reindex();
   }
 
   // erase()
@@ -133,7 +378,9 @@ class flat_set {
     return this->erase(static_cast<const_iterator>(pos));
   }
   constexpr iterator erase(const_iterator pos) { // 2
-    return key_container.erase(pos);
+    auto it = key_container.erase(pos);
+    this->reindex();
+    return it;
   }
   constexpr size_type erase(const Key& key) { // 4
     auto it = this->find(key);
@@ -145,7 +392,10 @@ class flat_set {
     }
   }
 
-  constexpr void clear() noexcept { key_container.clear(); }
+  constexpr void clear() noexcept {
+    key_container.clear();
+    this->reindex();
+  }
 
   /////////
   // Lookup
@@ -153,12 +403,8 @@ class flat_set {
   template <class Self, class K>
   constexpr auto find(this Self&& self, const K& key)
       -> decltype(self.begin()) {
-    auto it = self.lower_bound(key);
-    if ((it == self.end()) || (*it == key)) {
-      return it;
-    } else {
-      return self.end();
-    }
+    return self.key_container.begin() +
+           self.search_index.find(self.key_span(), key, self.compare);
   }
 
   template <class K>
@@ -174,10 +420,62 @@ class flat_set {
   template <class Self, class K>
   constexpr auto lower_bound(this Self&& self, const K& key)
       -> decltype(self.begin()) {
-    return std::ranges::lower_bound(self.key_container, key, self.compare);
+    return self.key_container.begin() +
+           self.search_index.lower_bound(self.key_span(), key, self.compare);
   }
 
  private:
+  constexpr std::span<const Key> key_span() const {
+    return std::span<const Key>{key_container};
+  }
+  constexpr void reindex() { search_index.rebuild(this->key_span()); }
+
+  constexpr bool equivalent(const value_type& lhs,
+                            const value_type& rhs) const {
+    return !compare(lhs, rhs) && !compare(rhs, lhs);
+  }
+
+  /// Sorts the elements appended from first_new on and merges them in,
+  /// stable so the first of equivalent new elements is the one kept
+  constexpr void sort_unique_from(size_type first_new) {
+    const auto first = key_container.begin() + first_new;
+    if (std::is_constant_evaluated()) {
+      // stable_sort is only constexpr from C++26, an insertion sort is stable
+      for (auto it = first; it != key_container.end(); ++it) {
+        std::ranges::rotate(std::ranges::upper_bound(first, it, *it, compare),
+                            it, it + 1);
+      }
+    } else {
+      std::ranges::stable_sort(first, key_container.end(), compare);
+    }
+    this->merge_unique_from(first_new);
+  }
+
+  /// Merges the sorted elements appended from first_new on,
+  /// of equivalent ones the one that was there first stays
+  constexpr void merge_unique_from(size_type first_new) {
+    if ((first_new > 0) && (first_new < key_container.size())) {
+      auto merged = container_type{};
+      if constexpr (requires { merged.reserve(key_container.size()); }) {
+        merged.reserve(key_container.size());
+      }
+      // Takes from the first range on ties, the existing elements first
+      std::ranges::merge(
+          std::make_move_iterator(key_container.begin()),
+          std::make_move_iterator(key_container.begin() + first_new),
+          std::make_move_iterator(key_container.begin() + first_new),
+          std::make_move_iterator(key_container.end()),
+          std::back_inserter(merged), compare);
+      key_container = std::move(merged);
+    }
+    const auto duplicates = std::ranges::unique(
+        key_container, [this](const value_type& lhs, const value_type& rhs) {
+          return this->equivalent(lhs, rhs);
+        });
+    key_container.erase(duplicates.begin(), duplicates.end());
+    this->reindex();
+  }
+
   template <class V = value_type>
   constexpr std::pair<iterator, bool> insert_generic(
       [[maybe_unused]] const_iterator hint, V&& key) {
@@ -186,6 +484,7 @@ class flat_set {
     if ((existing_it == cend()) || (*existing_it != key)) {
       // NOTE: This could potentially be made faster if using another container
       auto it = key_container.insert(existing_it, std::forward<V>(key));
+      this->reindex();
       return {it, true};
     } else {
       return {existing_it, false};
@@ -195,6 +494,8 @@ class flat_set {
  private:
   container_type key_container; // AKA c
   key_compare compare;
+  AOC_NO_UNIQUE_ADDRESS
+  typename Layout::template index<Key, Compare> search_index;
 };
 
 // Barebones implementation of
@@ -202,7 +503,7 @@ class flat_set {
 // NOTE: Can be replaced by std::flat_map in C++26
 template <class Key, class T, class Compare = std::ranges::less,
           class KeyContainer = std::vector<Key>,
-          class MappedContainer = std::vector<T>>
+          class MappedContainer = std::vector<T>, class Layout = sorted_layout>
 class flat_map {
  public:
   using key_container_type = KeyContainer;
@@ -417,6 +718,24 @@ class flat_map {
   constexpr explicit flat_map(const key_compare& comp) // 10
       : compare(comp) {}
 
+  constexpr flat_map(key_container_type key_cont,
+                     mapped_container_type mapped_cont,
+                     const key_compare& comp = key_compare()) // 2
+      : compare(comp) {
+    AOC_ASSERT(key_cont.size() == mapped_cont.size(),
+               "Key and value containers must be same size");
+    this->insert_sorted(this->sorted_order(key_cont), key_cont, mapped_cont);
+  }
+
+  constexpr flat_map(sorted_unique_t, key_container_type key_cont,
+                     mapped_container_type mapped_cont,
+                     const key_compare& comp = key_compare()) // 6
+      : storage{std::move(key_cont), std::move(mapped_cont)}, compare(comp) {
+    AOC_ASSERT(storage.keys.size() == storage.values.size(),
+               "Key and value containers must be same size");
+    this->reindex();
+  }
+
   template <class InputIter>
   constexpr flat_map(InputIter first, InputIter last,
                      const key_compare& comp = key_compare()) // 13
@@ -424,6 +743,20 @@ class flat_map {
     this->insert(first, last);
   }
 
+  template <class InputIter>
+  constexpr flat_map(sorted_unique_t, InputIter first, InputIter last,
+                     const key_compare& comp = key_compare()) // 17
+      : compare(comp) {
+    this->insert(sorted_unique, first, last);
+  }
+
+  template <std::ranges::input_range R>
+  constexpr flat_map(ranges::from_range_t, R&& range,
+                     const key_compare& comp = key_compare()) // 21
+      : compare(comp) {
+    this->insert_range(std::forward<R>(range));
+  }
+
   constexpr flat_map(std::initializer_list<value_type> init,
                      const key_compare& comp = key_compare()) // 23
       : flat_map(init.begin(), init.end(), comp) {}
@@ -502,7 +835,11 @@ class flat_map {
         .first;
   }
 
-  constexpr containers extract() && { return std::move(storage); }
+  constexpr containers extract() && {
+    auto extracted = std::move(storage);
+    this->clear();
+    return extracted;
+  }
 
   /// Preconditions:
   /// 1. The expression key_cont.size() == mapped_cont.size() is true
@@ -514,11 +851,13 @@ class flat_map {
                "1. Key and value containers must be same size");
     storage.keys = std::move(key_cont);
     storage.values = std::move(mapped_cont);
+    this->reindex();
   }
 
   constexpr void clear() noexcept {
     storage.keys.clear();
     storage.values.clear();
+    this->reindex();
   }
 
   // try_emplace
@@ -559,13 +898,30 @@ class flat_map {
   constexpr iterator insert(const_iterator pos, value_type&& value) { // 4
     return this->emplace_hint(pos, std::move(value));
   }
+  /// Sorts the range aside and merges it in,
+  /// O(m log m + n) instead of an insert shifting the tails per element.
+  /// Of equal keys the one already in the map, or else the first one, stays.
   template <class InputIt>
   constexpr void insert(InputIt first, InputIt last) { // 7
-    for (auto&& elem : std::ranges::subrange(first, last)) {
-      this->emplace(std::move(elem));
-    }
+    this->insert_range(std::ranges::subrange(first, last));
+  }
+  /// O(m + n), the range is merged in as it is
+  template <class InputIt>
+  constexpr void insert(sorted_unique_t, InputIt first, InputIt last) { // 8
+    this->insert_range(sorted_unique, std::ranges::subrange(first, last));
+  }
+  template <std::ranges::input_range R>
+  constexpr void insert_range(R&& range) { // 12
+    auto [keys, values] = this->split_range(std::forward<R>(range));
+    this->insert_sorted(this->sorted_order(keys), keys, values);
   }
-  constexpr void insert(std::initializer_list<key_type> ilist) { // 9
+  template <std::ranges::input_range R>
+  constexpr void insert_range(sorted_unique_t, R&& range) { // 13
+    auto [keys, values] = this->split_range(std::forward<R>(range));
+    this->insert_sorted(std::views::iota(size_type{0}, keys.size()), keys,
+                        values);
+  }
+  constexpr void insert(std::initializer_list<value_type> ilist) { // 9
     this->insert(ilist.begin(), ilist.end());
   }
 
@@ -576,6 +932,7 @@ class flat_map {
   constexpr iterator erase(const_iterator pos) { // 2
     auto key_it = storage.keys.erase(pos.private_impl_getkey());
     auto value_it = storage.values.erase(pos.private_impl_getmapped());
+    this->reindex();
     return this->make_iterator(key_it, value_it);
   }
   constexpr size_type erase(const Key& key) { // 4
@@ -594,12 +951,9 @@ class flat_map {
   template <class Self, class K>
   constexpr auto find(this Self&& self, const K& key)
       -> decltype(self.begin()) {
-    auto key_it = self.lower_bound_key(key);
-    if ((key_it == self.storage.keys.end()) || (*key_it == key)) {
-      return self.make_iterator(key_it);
-    } else {
-      return self.end();
-    }
+    return self.make_iterator(
+        self.storage.keys.begin() +
+        self.search_index.find(self.key_span(), key, self.compare));
   }
 
   template <class K>
@@ -650,19 +1004,96 @@ class flat_map {
       auto key_it = storage.keys.insert(existing_it, std::forward<K>(key));
       auto value_it = storage.values.emplace(existing_value_it,
                                              std::forward<Args>(args)...);
+      this->reindex();
       return {this->make_iterator(key_it, value_it), true};
     } else {
       return {this->make_iterator(existing_it), false};
     }
   }
 
+  template <std::ranges::input_range R>
+  constexpr containers split_range(R&& range) {
+    auto split = containers{};
+    if constexpr (std::ranges::sized_range<R> &&
+                  requires { split.keys.reserve(0); }) {
+      split.keys.reserve(std::ranges::size(range));
+      split.values.reserve(std::ranges::size(range));
+    }
+    // Moves out of the elements only when the range hands out rvalues
+    for (auto&& element : range) {
+      using element_t = decltype(element);
+      split.keys.push_back(std::get<0>(std::forward<element_t>(element)));
+      split.values.push_back(std::get<1>(std::forward<element_t>(element)));
+    }
+    return split;
+  }
+
+  /// The order that sorts keys, the earlier of equal keys first
+  constexpr std::vector<size_type> sorted_order(
+      const key_container_type& keys) const {
+    auto order = std::vector<size_type>(keys.size());
+    std::iota(order.begin(), order.end(), size_type{0});
+    std::ranges::sort(order, [&](size_type lhs, size_type rhs) {
+      if (compare(keys[lhs], keys[rhs])) {
+        return true;
+      }
+      return !compare(keys[rhs], keys[lhs]) && (lhs < rhs);
+    });
+    return order;
+  }
+
+  /// Merges keys and values, taken in the given sorted order,
+  /// with what is in the map in a single pass over both
+  template <class Order>
+  constexpr void insert_sorted(Order&& order, key_container_type& keys,
+                               mapped_container_type& values) {
+    auto merged = containers{};
+    if constexpr (requires { merged.keys.reserve(0); }) {
+      merged.keys.reserve(this->size() + keys.size());
+      merged.values.reserve(this->size() + keys.size());
+    }
+    auto old_key = storage.keys.begin();
+    auto old_value = storage.values.begin();
+    const auto take_old = [&] {
+      merged.keys.push_back(std::move(*old_key++));
+      merged.values.push_back(std::move(*old_value++));
+    };
+    for (const auto index : order) {
+      const auto& key = keys[index];
+      while ((old_key != storage.keys.end()) && compare(*old_key, key)) {
+        take_old();
+      }
+      const bool in_map =
+          (old_key != storage.keys.end()) && !compare(key, *old_key);
+      const bool repeated =
+          !merged.keys.empty() && !compare(merged.keys.back(), key);
+      if (in_map || repeated) {
+        continue;
+      }
+      merged.keys.push_back(std::move(keys[index]));
+      merged.values.push_back(std::move(values[index]));
+    }
+    while (old_key != storage.keys.end()) {
+      take_old();
+    }
+    storage = std::move(merged);
+    this->reindex();
+  }
+
+  constexpr std::span<const Key> key_span() const {
+    return std::span<const Key>{storage.keys};
+  }
+  constexpr void reindex() { search_index.rebuild(this->key_span()); }
+
   template <class K>
   constexpr key_iterator lower_bound_key(const K& key) {
-    return std::ranges::lower_bound(storage.keys, key, compare);
+    return storage.keys.begin() +
+           search_index.lower_bound(this->key_span(), key, compare);
   }
   template <class K>
   constexpr const_key_iterator lower_bound_key(const K& key) const {
-    return std::ranges::lower_bound(storage.keys, key, compare);
+    return storage.keys.begin() +
+           search_index.lower_bound(this->key_span(), key, compare);
   }
 
   constexpr value_iterator matching_value_iterator(key_iterator key_it) {
@@ -684,8 +1115,89 @@ class flat_map {
  private:
   containers storage; // AKA c
   key_compare compare;
+  AOC_NO_UNIQUE_ADDRESS
+  typename Layout::template index<Key, Compare> search_index;
 };
 
+namespace detail {
+
+/// Equivalent by the first member alone, to tell which equivalent one stays
+struct compare_first {
+  constexpr bool operator()(const std::pair<int, int>& lhs,
+                            const std::pair<int, int>& rhs) const {
+    return lhs.first < rhs.first;
+  }
+};
+
+using flat_set_test_t = flat_set<std::pair<int, int>, compare_first>;
+using flat_set_test_values_t = std::vector<std::pair<int, int>>;
+
+} // namespace detail
+
+// Of equivalent elements, the one already there stays,
+// otherwise the first of those in the range
+static_assert([] {
+  const auto range = detail::flat_set_test_values_t{
+      {3, 0}, {1, 0}, {3, 1}, {2, 0}, {1, 1}};
+  const auto set = detail::flat_set_test_t(range.begin(), range.end());
+  return std::ranges::equal(
+      set, detail::flat_set_test_values_t{{1, 0}, {2, 0}, {3, 0}});
+}());
+static_assert([] {
+  auto set = detail::flat_set_test_t{{2, 0}, {4, 0}};
+  const auto range =
+      detail::flat_set_test_values_t{{4, 1}, {1, 1}, {3, 1}, {1, 2}, {3, 2}};
+  set.insert(range.begin(), range.end());
+  return std::ranges::equal(set, detail::flat_set_test_values_t{
+                                     {1, 1}, {2, 0}, {3, 1}, {4, 0}});
+}());
+static_assert([] {
+  auto set = detail::flat_set_test_t{{2, 0}};
+  set.insert_range(detail::flat_set_test_values_t{{2, 1}, {0, 1}, {0, 2}});
+  set.insert_range(sorted_unique, std::array<std::pair<int, int>, 2>{
+                                      {{1, 3}, {2, 3}}});
+  return std::ranges::equal(
+      set, detail::flat_set_test_values_t{{0, 1}, {1, 3}, {2, 0}});
+}());
+static_assert([] {
+  const auto keys = std::vector{1, 3, 5};
+  const auto set = flat_set<int>(sorted_unique, keys.begin(), keys.end());
+  const auto map =
+      flat_map<int, char>(sorted_unique, std::vector{1, 3}, {'a', 'b'});
+  return std::ranges::equal(set, keys) && (map.at(3) == 'b') &&
+         (map.size() == 2);
+}());
+static_assert([] {
+  auto map = flat_map<int, char>{{3, 'c'}, {1, 'a'}, {3, 'x'}};
+  map.insert_range(std::vector<std::pair<int, char>>{
+      {3, 'y'}, {2, 'b'}, {0, 'z'}, {2, 'x'}, {1, 'x'}});
+  return std::ranges::equal(map.keys(), std::vector{0, 1, 2, 3}) &&
+         std::ranges::equal(map.values(), std::vector{'z', 'a', 'b', 'c'});
+}());
+
+/**
+ * A flat_set searched in Eytzinger order, see eytzinger_layout.
+ *
+ * reindex() rebuilds the whole copy on every insert and erase,
+ * filling one an element at a time is quadratic.
+ * Build it from all the keys at once, sorted_unique if they already are.
+ */
+template <class Key, class Compare = std::ranges::less>
+using eytzinger_set =
+    flat_set<Key, Compare, std::vector<Key>, eytzinger_layout>;
+
+/**
+ * A flat_map searched in Eytzinger order, see eytzinger_layout.
+ *
+ * reindex() rebuilds the whole copy on every insert_generic, try_emplace
+ * and erase, filling one through operator[] is quadratic.
+ * Build it from all the keys and values at once,
+ * sorted_unique if they already are, like 2024/day01.
+ */
+template <class Key, class T, class Compare = std::ranges::less>
+using eytzinger_map = flat_map<Key, T, Compare, std::vector<Key>,
+                               std::vector<T>, eytzinger_layout>;
+
 // https://stackoverflow.com/a/79004379
 template <class FlatMap>
 void reserve_map(FlatMap& map, typename FlatMap::size_type new_cap) {
@@ -686,7 +686,6 @@ template <class... ReadArgsTs>
 std::pair<char_grid<>, char_grid_config_output> read_char_grid(
     const std::string& filename, const char_grid_config_input config,
     ReadArgsTs... read_args) {
-  char_grid<> return_grid;
   char_grid_config_output config_output{};
   using point = char_grid_config_output::point;
   const bool padding = config.padding.has_value();
@@ -703,32 +702,53 @@ std::pair<char_grid<>, char_grid_config_output> read_char_grid(
       });
     });
   };
-  for (std::string line :
-       views::read_lines(filename, std::forward<ReadArgsTs>(read_args)...)) {
-    if (padding && return_grid.empty()) {
-      return_grid.add_row(std::views::repeat(*config.padding, line.size() + 2));
-    }
-    const auto row_id = return_grid.num_rows();
+  // Rows are copied straight out of the file into the grid's storage,
+  // the only two allocations
+  const auto input = read_file(filename);
+  auto lines = views::lines(input, std::forward<ReadArgsTs>(read_args)...);
+  auto it = std::ranges::begin(lines);
+  if (it == std::ranges::end(lines)) {
+    return {};
+  }
+  const auto padding_size = static_cast<std::size_t>(padding);
+  const auto row_length = (*it).size() + (2 * padding_size);
+  // Every line is at least as long as the first one trimmed, plus its '\n',
+  // so this is never too few
+  const auto max_rows =
+      ((input.size() + 1) / ((*it).size() + 1)) + (2 * padding_size);
+
+  auto data = std::string{};
+  data.reserve(max_rows * row_length);
+  if (padding) {
+    data.append(row_length, *config.padding);
+  }
+  std::size_t row_id = padding_size;
+  for (; it != std::ranges::end(lines); ++it) {
+    const std::string_view line = *it;
+    AOC_ASSERT(line.size() + (2 * padding_size) == row_length,
+               "All rows of a char grid must have the same length");
     set_once(config_output.start_pos, config.start_char, line, row_id);
     set_once(config_output.end_pos, config.end_char, line, row_id);
     if (padding) {
-      return_grid.add_row(*config.padding + std::move(line) + *config.padding);
-    } else {
-      return_grid.add_row(std::move(line));
+      data.push_back(*config.padding);
+    }
+    data.append(line);
+    if (padding) {
+      data.push_back(*config.padding);
     }
+    ++row_id;
   }
   if (padding) {
-    return_grid.add_row(
-        std::views::repeat(*config.padding, return_grid.row_length()));
+    data.append(row_length, *config.padding);
+    ++row_id;
   }
-  return std::pair{return_grid, config_output};
+  return {char_grid<>{std::move(data), row_id, row_length}, config_output};
 }
 
 template <class... ReadArgsTs>
 auto read_char_grid(const std::string& filename, ReadArgsTs... read_args) {
-  auto [grid, _] =
-      read_char_grid(filename, {}, std::forward<ReadArgsTs>(read_args)...);
-  return grid;
+  return read_char_grid(filename, {}, std::forward<ReadArgsTs>(read_args)...)
+      .first;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
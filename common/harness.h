@@ -0,0 +1,585 @@
+#ifndef AOC_HARNESS_H
+#define AOC_HARNESS_H
+
+// The machinery behind AOC_EXPECT_RESULT.
+//
+// Not part of the module: it holds the state of the test
+// currently running in this process, which is never meant to be shared,
+// and it is only ever included from common.h,
+// once the standard library is in by whichever route that took.
+
+#include "compiler.h"
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+#include <system_error>
+#endif
+
+namespace aoc::harness {
+
+inline std::optional<std::string> environment_variable(const char* name) {
+#ifdef AOC_COMPILER_MSVC
+  // getenv is deprecated on MSVC,
+  // its replacement hands out a copy that has to be freed
+  char* buffer = nullptr;
+  std::size_t size = 0;
+  if ((_dupenv_s(&buffer, &size, name) != 0) || (buffer == nullptr)) {
+    return {};
+  }
+  auto value = std::string{buffer};
+  std::free(buffer);
+  return value;
+#else
+  const char* value = std::getenv(name);
+  if (value == nullptr) {
+    return {};
+  }
+  return std::string{value};
+#endif
+}
+
+/// A missing or malformed variable reads as the fallback
+inline int environment_int(const char* name, int fallback) {
+  const auto value = environment_variable(name);
+  if (!value) {
+    return fallback;
+  }
+  int parsed = fallback;
+  const auto [_, ec] =
+      std::from_chars(value->data(), value->data() + value->size(), parsed);
+  return (ec == std::errc{}) ? parsed : fallback;
+}
+
+/**
+ * Everything the harness can be told from outside the test.
+ *
+ * Read from the environment rather than the command line,
+ * the tests all have an argument-less main.
+ * CMake forwards its own cache variables of the same names
+ * to every test it registers, see add_sample.
+ *
+ * - AOC_BENCH_REPETITIONS: when positive, every AOC_EXPECT_RESULT
+ *   runs its expression that many times and reports the distribution
+ * - AOC_BENCH_WARMUP: untimed runs before those, defaults to 1
+ * - AOC_RESULTS_FILE: appends one record per check to this file,
+ *   CSV if it ends in .csv, JSON Lines otherwise
+ * - AOC_REPORT_MEMORY: when non-zero, every check and the final summary
+ *   report peak resident memory and page faults
+ * - AOC_SCALED_INPUT: a generated input to solve instead of the usual ones,
+ *   see scaled_input
+ * - AOC_PARSE_CACHE: a directory to keep snapshots of the parsed inputs in,
+ *   see cached_parse
+ */
+struct options {
+  int bench_repetitions = 0;
+  int bench_warmup = 1;
+  std::string results_file;
+  bool report_memory = false;
+  std::string scaled_input;
+  std::string parse_cache;
+
+  bool benchmarking() const { return bench_repetitions > 0; }
+};
+
+inline const options& get_options() {
+  static const auto opts = [] {
+    auto result = options{};
+    result.bench_repetitions =
+        environment_int("AOC_BENCH_REPETITIONS", result.bench_repetitions);
+    result.bench_warmup =
+        environment_int("AOC_BENCH_WARMUP", result.bench_warmup);
+    result.report_memory = environment_int("AOC_REPORT_MEMORY", 0) != 0;
+    // All made absolute up front,
+    // the runner changes directories between days
+    const auto make_absolute = [](std::string& path) {
+      if (path.empty()) {
+        return;
+      }
+      auto error = std::error_code{};
+      const auto absolute = std::filesystem::absolute(path, error);
+      if (!error) {
+        path = absolute.string();
+      }
+    };
+    result.results_file =
+        environment_variable("AOC_RESULTS_FILE").value_or("");
+    make_absolute(result.results_file);
+    result.scaled_input =
+        environment_variable("AOC_SCALED_INPUT").value_or("");
+    make_absolute(result.scaled_input);
+    result.parse_cache = environment_variable("AOC_PARSE_CACHE").value_or("");
+    make_absolute(result.parse_cache);
+    return result;
+  }();
+  return opts;
+}
+
+/**
+ * The input generated by aoc_scaled, when the test is run on one.
+ *
+ * Tests with a generator in tools/scaled/ check for it first thing
+ * and solve only that, with AOC_SCALED_RESULT -
+ * nothing is known about its answers.
+ */
+inline std::optional<std::string> scaled_input() {
+  const auto& path = get_options().scaled_input;
+  if (path.empty()) {
+    return {};
+  }
+  return path;
+}
+
+/// Identifies the test a check belongs to, filled in by common.h
+struct test_id {
+  int year;
+  std::string_view day;
+};
+
+/// Where in the test the next check lands
+struct progress {
+  int part = 0;
+  int check = 0;
+};
+
+inline progress& current_progress() {
+  static auto state = progress{};
+  return state;
+}
+
+inline void begin_part(int part) {
+  current_progress().part = part;
+  std::println("Part {}", part);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Phases
+
+/**
+ * Marks the point the harness came up, everything before is startup.
+ *
+ * Being in common.h, which every test includes first,
+ * this is among the first things dynamically initialized.
+ * What the process did before that - loading, relocating,
+ * initializing the runtime - is read off std::clock():
+ * CPU time so far on POSIX, which is all startup is spent on,
+ * and wall time since the process started on MSVC's CRT.
+ */
+struct process_clock {
+  timer::clock::time_point started = timer::clock::now();
+  double startup_ms = []() -> double {
+    const auto ticks = std::clock();
+    if (ticks == static_cast<std::clock_t>(-1)) {
+      return 0;
+    }
+    return 1000.0 * static_cast<double>(ticks) / CLOCKS_PER_SEC;
+  }();
+};
+inline const process_clock process_started{};
+
+/// Time attributed so far in the current test, in nanoseconds
+struct phase_times {
+  timer::clock::time_point started = process_started.started;
+  double startup_ms = process_started.startup_ms;
+  std::int64_t parse_ns = 0;
+  // The median of every check, the single run outside benchmark mode
+  std::int64_t solve_ns = 0;
+  // Wall time spent inside the checks, repetitions included
+  std::int64_t checks_ns = 0;
+};
+
+inline phase_times& current_phases() {
+  static auto phases = phase_times{};
+  return phases;
+}
+
+/// Times the expression as parsing, see AOC_TIMED_PARSE
+template <class F>
+auto timed_parse(F&& parse) {
+  auto parse_timer = timer{};
+  parse_timer.start();
+  auto parsed = parse();
+  parse_timer.stop();
+  current_phases().parse_ns += parse_timer.nanoseconds();
+  return parsed;
+}
+
+/// Starts the accounting over for the next test sharing the process,
+/// the startup has already been paid for by the first one
+inline void begin_test() {
+  current_progress() = progress{};
+  current_phases() = phase_times{.started = timer::clock::now(),
+                                 .startup_ms = 0};
+}
+
+/**
+ * Prints where the test spent its time.
+ *
+ * Whatever is neither parsing nor checking - output, unwrapped parsing,
+ * any setup in main - shows up as other.
+ * In benchmark mode solve sums the medians
+ * while total includes every repetition, so the phases add up to less.
+ */
+inline void print_summary() {
+  const auto& phases = current_phases();
+  const auto main_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           timer::clock::now() - phases.started)
+                           .count();
+  const auto other_ns =
+      std::max<std::int64_t>(main_ns - phases.parse_ns - phases.checks_ns, 0);
+  const auto to_ms = [](std::int64_t ns) {
+    return static_cast<double>(ns) / 1'000'000.0;
+  };
+  std::println("Time: startup {:.3f} ms, parse {:.3f} ms, solve {:.3f} ms, "
+               "other {:.3f} ms, total {:.3f} ms",
+               phases.startup_ms, to_ms(phases.parse_ns),
+               to_ms(phases.solve_ns), to_ms(other_ns),
+               phases.startup_ms + to_ms(main_ns));
+
+  if (get_options().report_memory) {
+    if (const auto memory = read_memory_usage()) {
+      std::println("Memory: peak RSS {:.1f} MiB, {} minor and {} major faults",
+                   static_cast<double>(memory->lifetime_peak_rss_kb) / 1024.0,
+                   memory->minor_faults, memory->major_faults);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Records
+
+struct check_record {
+  test_id test;
+  progress position;
+  std::string_view expression;
+  std::string input;
+  std::string expected;
+  std::string actual;
+  bool passed;
+  benchmark_stats stats;
+  // Only with AOC_TRACK_ALLOCATIONS
+  std::optional<allocation_stats> allocations;
+  // Only with AOC_REPORT_MEMORY, faults counted during the check alone
+  std::optional<memory_usage> memory;
+};
+
+/**
+ * Guesses which input a check ran on from the text of its expression.
+ *
+ * Every test names its parsed inputs after the file they came from -
+ * `example`, `example2`, `input` - so the first identifier
+ * starting with either of those is taken as the input name.
+ * Anything else, a literal or a precomputed value, records as empty.
+ */
+constexpr std::string_view input_name(std::string_view expression) {
+  const auto is_identifier = [](char c) {
+    return (c == '_') ||
+           ((c >= '0') && (c <= '9')) ||
+           ((c >= 'a') && (c <= 'z')) ||
+           ((c >= 'A') && (c <= 'Z'));
+  };
+  std::size_t pos = 0;
+  while (pos < expression.size()) {
+    if (!is_identifier(expression[pos])) {
+      ++pos;
+      continue;
+    }
+    const auto start = pos;
+    while ((pos < expression.size()) && is_identifier(expression[pos])) {
+      ++pos;
+    }
+    const auto token = expression.substr(start, pos - start);
+    if (token.starts_with("example") || token.starts_with("input")) {
+      return token;
+    }
+  }
+  return {};
+}
+static_assert("example2" == input_name("solve_case2(example2)"));
+static_assert("input" == input_name("(solve_case<8, false>(input))"));
+static_assert(input_name("solve(parse_example)").empty());
+static_assert(input_name("11820").empty());
+
+inline std::string json_escape(std::string_view text) {
+  auto escaped = std::string{};
+  escaped.reserve(text.size());
+  for (const char c : text) {
+    switch (c) {
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      case '\r':
+        escaped += "\\r";
+        break;
+      case '\t':
+        escaped += "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          escaped += std::format("\\u{:04x}", static_cast<unsigned>(c));
+        } else {
+          escaped += c;
+        }
+    }
+  }
+  return escaped;
+}
+
+inline std::string csv_escape(std::string_view text) {
+  if (text.find_first_of(",\"\r\n") == std::string_view::npos) {
+    return std::string{text};
+  }
+  auto escaped = std::string{"\""};
+  for (const char c : text) {
+    if (c == '"') {
+      escaped += '"';
+    }
+    escaped += c;
+  }
+  escaped += '"';
+  return escaped;
+}
+
+inline constexpr std::string_view csv_header =
+    "year,day,part,check,input,expression,expected,actual,passed,"
+    "runs,min_ns,median_ns,p95_ns,mean_ns,stddev_ns,"
+    "allocations,allocated_bytes,peak_bytes,"
+    "peak_rss_kb,minor_faults,major_faults";
+
+inline std::string format_csv(const check_record& record) {
+  // Empty cells when allocations are not tracked
+  const auto allocations =
+      record.allocations
+          ? std::format("{},{},{}", record.allocations->allocations,
+                        record.allocations->bytes,
+                        record.allocations->peak_bytes)
+          : std::string{",,"};
+  const auto memory =
+      record.memory ? std::format("{},{},{}", record.memory->peak_rss_kb,
+                                  record.memory->minor_faults,
+                                  record.memory->major_faults)
+                    : std::string{",,"};
+  return std::format(
+      "{},{},{},{},{},{},{},{},{},{},{},{},{},{:.0f},{:.0f},{},{}",
+      record.test.year,
+      csv_escape(record.test.day), record.position.part, record.position.check,
+      csv_escape(record.input), csv_escape(record.expression),
+      csv_escape(record.expected), csv_escape(record.actual), record.passed,
+      record.stats.runs, record.stats.min_ns, record.stats.median_ns,
+      record.stats.p95_ns, record.stats.mean_ns, record.stats.stddev_ns,
+      allocations, memory);
+}
+
+/// One flat object per line, nothing but strings, numbers and booleans -
+/// the report tool in tools/ does not parse anything beyond that
+inline std::string format_json(const check_record& record) {
+  // Left out entirely when allocations are not tracked
+  const auto allocations =
+      record.allocations
+          ? std::format(R"(,"allocations":{},"allocated_bytes":{},)"
+                        R"("peak_bytes":{})",
+                        record.allocations->allocations,
+                        record.allocations->bytes,
+                        record.allocations->peak_bytes)
+          : std::string{};
+  const auto memory =
+      record.memory
+          ? std::format(R"(,"peak_rss_kb":{},"minor_faults":{},)"
+                        R"("major_faults":{})",
+                        record.memory->peak_rss_kb,
+                        record.memory->minor_faults,
+                        record.memory->major_faults)
+          : std::string{};
+  return std::format(
+      R"({{"year":{},"day":"{}","part":{},"check":{},"input":"{}",)"
+      R"("expression":"{}","expected":"{}","actual":"{}","passed":{},)"
+      R"("runs":{},"min_ns":{},"median_ns":{},"p95_ns":{},)"
+      R"("mean_ns":{:.0f},"stddev_ns":{:.0f}{}{}}})",
+      record.test.year, json_escape(record.test.day), record.position.part,
+      record.position.check, json_escape(record.input),
+      json_escape(record.expression), json_escape(record.expected),
+      json_escape(record.actual), record.passed, record.stats.runs,
+      record.stats.min_ns, record.stats.median_ns, record.stats.p95_ns,
+      record.stats.mean_ns, record.stats.stddev_ns, allocations, memory);
+}
+
+/**
+ * Appends the record to the results file, if there is one.
+ *
+ * The file is opened for every record rather than held open:
+ * a test that crashes halfway still leaves every check before the crash
+ * behind, and a single short append per line keeps parallel ctest runs
+ * sharing one file from interleaving mid-record.
+ */
+inline void write_record(const check_record& record) {
+  const auto& path = get_options().results_file;
+  if (path.empty()) {
+    return;
+  }
+  const bool csv = std::filesystem::path{path}.extension() == ".csv";
+  auto error = std::error_code{};
+  if (const auto parent = std::filesystem::path{path}.parent_path();
+      !parent.empty()) {
+    std::filesystem::create_directories(parent, error);
+  }
+  const bool fresh = !std::filesystem::exists(path, error) ||
+                     (std::filesystem::file_size(path, error) == 0);
+  auto file = std::ofstream{path, std::ios::app};
+  if (!file) {
+    std::println("  Cannot write results to {}", path);
+    return;
+  }
+  auto line = std::string{};
+  if (csv && fresh) {
+    line += csv_header;
+    line += '\n';
+  }
+  line += csv ? format_csv(record) : format_json(record);
+  line += '\n';
+  file << line;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Checks
+
+/// Expected value of a check without a known answer, see AOC_SCALED_RESULT
+struct any_result {
+  template <class T>
+  friend constexpr bool operator!=(any_result, const T&) {
+    return false;
+  }
+};
+inline constexpr any_result unchecked{};
+
+/**
+ * Runs a single check, prints and records its outcome,
+ * and returns whether it passed.
+ *
+ * A plain run times the expression once.
+ * In benchmark mode the expression is re-run as configured,
+ * so it has to be repeatable - every solution takes its input by const
+ * reference, which is what makes this safe to do.
+ *
+ * With AOC_TRACK_ALLOCATIONS the allocations of the last run are reported,
+ * the previous result is already gone by then, see aoc::benchmark.
+ * With AOC_REPORT_MEMORY the peak resident memory and the page faults
+ * cover every run, the peak starting over for each check where Linux allows.
+ *
+ * Expecting any_result always passes and prints the answer instead.
+ */
+template <class Expected, class F>
+bool expect_result(test_id test, std::string_view expression,
+                   const Expected& expected, F&& solve) {
+  auto check_timer = timer{};
+  check_timer.start();
+  const auto& opts = get_options();
+  const auto config =
+      opts.benchmarking()
+          ? benchmark_config{.warmup = opts.bench_warmup,
+                             .repetitions = opts.bench_repetitions}
+          : benchmark_config{.warmup = 0, .repetitions = 1};
+  auto allocations = allocation_stats{};
+  const auto tracked_solve = [&]() {
+    const auto scope = allocation_scope{};
+    auto result = solve();
+    allocations = scope.stats();
+    return result;
+  };
+  auto memory = std::optional<memory_usage>{};
+  if (opts.report_memory) {
+    reset_peak_rss();
+    memory = read_memory_usage();
+  }
+  const auto [actual, stats] = aoc::benchmark(tracked_solve, config);
+  const bool passed = !(expected != actual);
+  if (memory) {
+    const auto before = *memory;
+    memory = read_memory_usage();
+    if (memory) {
+      memory->minor_faults -= before.minor_faults;
+      memory->major_faults -= before.major_faults;
+    }
+  }
+
+  const auto timing =
+      opts.benchmarking()
+          ? std::format(
+                "min {} ns, median {} ns, p95 {} ns, stddev {:.0f} ns ({} runs)",
+                stats.min_ns, stats.median_ns, stats.p95_ns, stats.stddev_ns,
+                stats.runs)
+          : std::format("{:.3f} ms", static_cast<double>(stats.min_ns) /
+                                         1'000'000.0);
+  const auto allocated =
+      allocation_tracking
+          ? std::format(", {} allocations, {} bytes, peak {} bytes",
+                        allocations.allocations, allocations.bytes,
+                        allocations.peak_bytes)
+          : std::string{};
+  const auto resident =
+      memory ? std::format(", peak RSS {:.1f} MiB, {} minor and {} major faults",
+                           static_cast<double>(memory->peak_rss_kb) / 1024.0,
+                           memory->minor_faults, memory->major_faults)
+             : std::string{};
+  constexpr bool checked = !std::same_as<Expected, any_result>;
+  if constexpr (!checked) {
+    std::println("  = {} {}{}{}", actual, timing, allocated, resident);
+  } else if (passed) {
+    std::println("  OK {}{}{}", timing, allocated, resident);
+  } else {
+    std::println("  FAIL {}{}{}: expected {}, got {}", timing, allocated,
+                 resident, expected, actual);
+  }
+
+  auto& phases = current_phases();
+  phases.solve_ns += stats.median_ns;
+
+  auto& position = current_progress();
+  ++position.check;
+  if (!opts.results_file.empty()) {
+    write_record({
+        .test = test,
+        .position = position,
+        .expression = expression,
+        .input = std::string{input_name(expression)},
+        .expected = [&] {
+          if constexpr (checked) {
+            return std::format("{}", expected);
+          } else {
+            return std::string{};
+          }
+        }(),
+        .actual = std::format("{}", actual),
+        .passed = passed,
+        .stats = stats,
+        .allocations = allocation_tracking
+                           ? std::optional{allocations}
+                           : std::optional<allocation_stats>{},
+        .memory = memory,
+    });
+  }
+  check_timer.stop();
+  phases.checks_ns += check_timer.nanoseconds();
+  return passed;
+}
+
+} // namespace aoc::harness
+
+#endif // AOC_HARNESS_H
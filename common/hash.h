@@ -146,10 +146,12 @@ concept hash_combinable =
  * Hashes a value over its whole object representation,
  * for types that are just packed bytes with no meaningful sub-structure.
  *
- * Meant to be inherited into a std::hash specialization:
+ * Meant to be named as the type's own hash, see std::hash below:
  * @code
- * template <>
- * struct std::hash<MyStruct> : aoc::packed_hash {};
+ * struct MyStruct {
+ *   ...
+ *   using aoc_hash = aoc::packed_hash;
+ * };
  * @endcode
  *
  * has_unique_object_representations rules out padding bits,
@@ -188,4 +190,15 @@ struct packed_hash {
 
 } // AOC_EXPORT_NAMESPACE(aoc)
 
+/**
+ * Hashes any type that names its hash as a member, `using aoc_hash = ...`.
+ *
+ * Unlike specializing std::hash directly, this also works for types
+ * declared inside a namespace, which is where the runner puts every day -
+ * std::hash can only be specialized from an enclosing namespace.
+ */
+template <class T>
+  requires requires { typename T::aoc_hash; }
+struct std::hash<T> : T::aoc_hash {};
+
 #endif // AOC_HASH_H
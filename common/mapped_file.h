@@ -0,0 +1,143 @@
+#ifndef AOC_MAPPED_FILE_H
+#define AOC_MAPPED_FILE_H
+
+// The whole input as one string_view, without copying it.
+//
+// Not part of the module: it needs the POSIX headers directly.
+// Like harness.h it is only ever included from common.h.
+//
+// Where mmap is available the file is mapped read only,
+// anywhere else, or for what cannot be mapped (empty files, pipes),
+// it is read once into a buffer of its size instead.
+
+#include "compiler.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AOC_MAPPED_FILE_SUPPORTED
+#endif
+
+#ifndef AOC_IMPORT_STD
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#endif
+
+namespace aoc {
+
+/**
+ * Owns the contents of a file, mapped into memory where possible.
+ *
+ * Like read_file, a file that cannot be opened reads as empty.
+ *
+ * @code
+ * const auto input = aoc::mapped_file{filename};
+ * for (std::string_view line : input.lines()) {
+ *   // line points into the mapping, nothing is allocated per line
+ * }
+ * @endcode
+ */
+class mapped_file {
+ public:
+  explicit mapped_file(const std::string& filename) {
+#ifdef AOC_MAPPED_FILE_SUPPORTED
+    if (map(filename)) {
+      return;
+    }
+#endif
+    m_buffer = read_file(filename);
+  }
+
+  mapped_file(const mapped_file&) = delete;
+  mapped_file& operator=(const mapped_file&) = delete;
+
+  mapped_file(mapped_file&& other) noexcept
+      : m_mapping{std::exchange(other.m_mapping, nullptr)},
+        m_size{std::exchange(other.m_size, 0)},
+        m_buffer{std::move(other.m_buffer)} {}
+
+  mapped_file& operator=(mapped_file&& other) noexcept {
+    auto moved = mapped_file{std::move(other)};
+    std::swap(m_mapping, moved.m_mapping);
+    std::swap(m_size, moved.m_size);
+    std::swap(m_buffer, moved.m_buffer);
+    return *this;
+  }
+
+  ~mapped_file() { unmap(); }
+
+  /// Valid for as long as this object is
+  [[nodiscard]] std::string_view view() const noexcept {
+    if (m_mapping != nullptr) {
+      return {m_mapping, m_size};
+    }
+    // Computed on every call, a moved buffer may have moved its characters
+    return m_buffer;
+  }
+
+  [[nodiscard]] bool mapped() const noexcept { return m_mapping != nullptr; }
+
+  /**
+   * The lines of the file as string_views into it,
+   * trimmed and filtered like views::read_lines.
+   *
+   * Takes the same keep_empty and keep_spaces tags.
+   */
+  template <class... Args>
+  [[nodiscard]] auto lines(Args... args) const& {
+    return views::lines(view(), args...);
+  }
+  // The lines would outlive the file
+  template <class... Args>
+  auto lines(Args... args) && = delete;
+
+ private:
+#ifdef AOC_MAPPED_FILE_SUPPORTED
+  bool map(const std::string& filename) {
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat info {};
+    void* mapping = MAP_FAILED;
+    if ((::fstat(fd, &info) == 0) && S_ISREG(info.st_mode) &&
+        (info.st_size > 0)) {
+      mapping = ::mmap(nullptr, static_cast<std::size_t>(info.st_size),
+                       PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    // The mapping holds on to the file by itself
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      return false;
+    }
+    m_mapping = static_cast<const char*>(mapping);
+    m_size = static_cast<std::size_t>(info.st_size);
+    // All of it is about to be read, a hint to start reading it in now
+    ::madvise(mapping, m_size, MADV_WILLNEED);
+    return true;
+  }
+#endif
+
+  void unmap() noexcept {
+#ifdef AOC_MAPPED_FILE_SUPPORTED
+    if (m_mapping != nullptr) {
+      ::munmap(const_cast<char*>(m_mapping), m_size);
+    }
+#endif
+    m_mapping = nullptr;
+    m_size = 0;
+  }
+
+  // Null when the file is in m_buffer instead
+  const char* m_mapping = nullptr;
+  std::size_t m_size = 0;
+  std::string m_buffer;
+};
+
+} // namespace aoc
+
+#endif // AOC_MAPPED_FILE_H
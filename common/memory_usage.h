@@ -0,0 +1,116 @@
+#ifndef AOC_MEMORY_USAGE_H
+#define AOC_MEMORY_USAGE_H
+
+// Resident memory and page faults of the process,
+// so memory regressions show up next to the time ones.
+//
+// Not part of the module: it needs the POSIX headers directly.
+// Like harness.h it is only ever included from common.h.
+//
+// getrusage gives the faults and the lifetime peak everywhere POSIX,
+// Linux's /proc/self/status adds the current resident size
+// and a peak that can be reset, which is what makes it per check.
+// Anywhere else nothing is available.
+
+#include "compiler.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#define AOC_MEMORY_USAGE_SUPPORTED
+#endif
+
+#ifndef AOC_IMPORT_STD
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#endif
+
+namespace aoc {
+
+/// All sizes in KiB, the unit the kernel reports them in
+struct memory_usage {
+  // Since the last reset_peak_rss, or since the start without one
+  std::uint64_t peak_rss_kb = 0;
+  std::uint64_t lifetime_peak_rss_kb = 0;
+  std::uint64_t rss_kb = 0;
+  // Served without I/O, typically the first touch of a fresh page
+  std::uint64_t minor_faults = 0;
+  // Had to wait for the disk
+  std::uint64_t major_faults = 0;
+};
+
+namespace detail {
+
+// Reads a "Name:   1234 kB" line of /proc/self/status
+inline std::optional<std::uint64_t> proc_status_kb(std::string_view name) {
+  auto file = std::ifstream{"/proc/self/status"};
+  for (auto line = std::string{}; std::getline(file, line);) {
+    if (!line.starts_with(name) || (line.size() <= name.size()) ||
+        (line[name.size()] != ':')) {
+      continue;
+    }
+    std::uint64_t value = 0;
+    bool found = false;
+    for (const char c : std::string_view{line}.substr(name.size() + 1)) {
+      if ((c >= '0') && (c <= '9')) {
+        value = value * 10 + static_cast<std::uint64_t>(c - '0');
+        found = true;
+      } else if (found) {
+        break;
+      }
+    }
+    return found ? std::optional{value} : std::nullopt;
+  }
+  return {};
+}
+
+} // namespace detail
+
+inline std::optional<memory_usage> read_memory_usage() {
+#ifdef AOC_MEMORY_USAGE_SUPPORTED
+  auto usage = rusage{};
+  if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+    return {};
+  }
+  auto result = memory_usage{
+      .minor_faults = static_cast<std::uint64_t>(usage.ru_minflt),
+      .major_faults = static_cast<std::uint64_t>(usage.ru_majflt),
+  };
+#ifdef __APPLE__
+  // Bytes on macOS, KiB everywhere else
+  result.lifetime_peak_rss_kb =
+      static_cast<std::uint64_t>(usage.ru_maxrss) / 1024;
+#else
+  result.lifetime_peak_rss_kb = static_cast<std::uint64_t>(usage.ru_maxrss);
+#endif
+  result.peak_rss_kb = detail::proc_status_kb("VmHWM")
+                           .value_or(result.lifetime_peak_rss_kb);
+  result.rss_kb = detail::proc_status_kb("VmRSS").value_or(0);
+  return result;
+#else
+  return {};
+#endif
+}
+
+/**
+ * Restarts peak_rss_kb from the current resident size.
+ *
+ * Linux only, through /proc/self/clear_refs.
+ * Returns whether it did, without it the peak keeps covering the whole run.
+ */
+inline bool reset_peak_rss() {
+#if defined(__linux__)
+  auto file = std::ofstream{"/proc/self/clear_refs"};
+  file << "5";
+  file.flush();
+  return static_cast<bool>(file);
+#else
+  return false;
+#endif
+}
+
+} // namespace aoc
+
+#endif // AOC_MEMORY_USAGE_H
@@ -4,6 +4,15 @@ module;
 // just to find out whether AOC_IMPORT_STD is set
 #include "compiler.h"
 
+// The intrinsics of scan.h are compiler headers rather than std ones,
+// textual either way
+#ifdef AOC_ARCH_X86_64
+#include <immintrin.h>
+#ifdef AOC_COMPILER_MSVC
+#include <intrin.h>
+#endif
+#endif
+
 #ifdef AOC_IMPORT_STD
 
 // `import std` does not carry macros across
@@ -76,7 +85,9 @@ import ankerl.unordered_dense;
 
 #include "algorithm.h"
 #include "assert.h"
+#include "benchmark.h"
 #include "bitmap_set.h"
+#include "chunked_reader.h"
 #include "combinations.h"
 #include "compiler.h"
 #include "concepts.h"
@@ -92,6 +103,8 @@ import ankerl.unordered_dense;
 #include "range_to.h"
 #include "ranges.h"
 #include "ratio.h"
+#include "scan.h"
+#include "small_vector.h"
 #include "static_vector.h"
 #include "string.h"
 #include "timer.h"
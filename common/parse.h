@@ -6,14 +6,23 @@
 
 #ifndef AOC_MODULE_SUPPORT
 #ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <charconv>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <system_error>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #endif
 #endif
@@ -78,6 +87,339 @@ struct number_converter {
   }
 };
 
+namespace detail {
+
+// SWAR: the 8 characters of a word are handled as its 8 bytes at once,
+// the first one in the lowest byte
+using swar_word = std::uint64_t;
+inline constexpr swar_word swar_ones = 0x0101010101010101;
+inline constexpr swar_word swar_high_bits = 0x8080808080808080;
+
+inline swar_word swar_load(const char* chars) {
+  swar_word word;
+  std::memcpy(&word, chars, sizeof(word));
+  return word;
+}
+
+/// The high bit of every byte that is not a digit
+constexpr swar_word swar_non_digits(swar_word word) {
+  // Neither sum carries into the next byte with the high bits masked off
+  const auto low_bits = word & ~swar_high_bits;
+  const auto above_nine = low_bits + (swar_ones * (0x80 - ':'));
+  const auto at_least_zero = low_bits + (swar_ones * (0x80 - '0'));
+  return (word | above_nine | ~at_least_zero) & swar_high_bits;
+}
+
+/// The value of the first num_digits bytes, all of them digits, 1 to 8
+constexpr swar_word swar_parse_digits(swar_word word, int num_digits) {
+  // What follows the digits is shifted out, zeros come in ahead of them
+  word <<= 8 * (8 - num_digits);
+  // http://govnokod.ru/13461, also in simdjson
+  word = ((word & 0x0F0F0F0F0F0F0F0F) * 2561) >> 8;
+  word = ((word & 0x00FF00FF00FF00FF) * 6553601) >> 16;
+  return ((word & 0x0000FFFF0000FFFF) * 42949672960001) >> 32;
+}
+
+constexpr bool is_digit(char c) { return (c >= '0') && (c <= '9'); }
+
+} // namespace detail
+
+/**
+ * Walks the integers in a text, skipping whatever is between them.
+ *
+ * A '-' right before the digits makes the integer negative
+ * for a signed T, the same numbers a "-?\\d+" regex would find.
+ * Values have to fit T, there is no overflow check.
+ *
+ * Eight characters at a time where it can, both to skip to the next digit
+ * and to read the digits, one at a time at compile time.
+ */
+template <std::integral T>
+class integer_scanner {
+ public:
+  constexpr explicit integer_scanner(std::string_view text)
+      : m_text{text} {}
+
+  /// False once there are no integers left
+  constexpr bool next(T& value) {
+    if (!this->skip_to_digit()) {
+      return false;
+    }
+    const bool negative =
+        std::signed_integral<T> && (m_pos > 0) && (m_text[m_pos - 1] == '-');
+    const auto magnitude = this->read_digits();
+    value = negative ? static_cast<T>(0 - magnitude)
+                     : static_cast<T>(magnitude);
+    return true;
+  }
+
+ private:
+  using unsigned_t = std::make_unsigned_t<T>;
+  // Wide enough that the multiplications below never promote to int
+  using accumulator_t = std::common_type_t<unsigned_t, std::uint64_t>;
+  static constexpr std::size_t word_size = sizeof(detail::swar_word);
+
+  constexpr bool fast() const {
+    return !std::is_constant_evaluated() &&
+           (std::endian::native == std::endian::little) &&
+           ((m_pos + word_size) <= m_text.size());
+  }
+
+  // Separators and numbers are mostly short, a few characters one at a time
+  // are cheaper than a word when that is all there is
+  static constexpr int scalar_separator_chars = 2;
+  static constexpr int scalar_digits = 3;
+
+  constexpr bool skip_to_digit() {
+    for (int i = 0; (i < scalar_separator_chars) && (m_pos < m_text.size());
+         ++i, ++m_pos) {
+      if (detail::is_digit(m_text[m_pos])) {
+        return true;
+      }
+    }
+    while (this->fast()) {
+      const auto non_digits =
+          detail::swar_non_digits(detail::swar_load(m_text.data() + m_pos));
+      if (const auto digits = ~non_digits & detail::swar_high_bits;
+          digits != 0) {
+        m_pos += static_cast<std::size_t>(std::countr_zero(digits) / 8);
+        return true;
+      }
+      m_pos += word_size;
+    }
+    while ((m_pos < m_text.size()) && !detail::is_digit(m_text[m_pos])) {
+      ++m_pos;
+    }
+    return m_pos < m_text.size();
+  }
+
+  constexpr unsigned_t read_digits() {
+    accumulator_t value = 0;
+    for (int i = 0; i < scalar_digits; ++i, ++m_pos) {
+      if ((m_pos >= m_text.size()) || !detail::is_digit(m_text[m_pos])) {
+        return static_cast<unsigned_t>(value);
+      }
+      value = (value * 10) + static_cast<accumulator_t>(m_text[m_pos] - '0');
+    }
+    while (this->fast()) {
+      const auto word = detail::swar_load(m_text.data() + m_pos);
+      const auto num_digits =
+          std::countr_zero(detail::swar_non_digits(word)) / 8;
+      if (num_digits == 0) {
+        break;
+      }
+      value = (value * pow10(num_digits)) +
+              detail::swar_parse_digits(word, num_digits);
+      m_pos += static_cast<std::size_t>(num_digits);
+      if (num_digits < 8) {
+        return static_cast<unsigned_t>(value);
+      }
+    }
+    while ((m_pos < m_text.size()) && detail::is_digit(m_text[m_pos])) {
+      value = (value * 10) + static_cast<accumulator_t>(m_text[m_pos] - '0');
+      ++m_pos;
+    }
+    return static_cast<unsigned_t>(value);
+  }
+
+  static constexpr accumulator_t pow10(int exponent) {
+    accumulator_t power = 1;
+    for (int i = 0; i < exponent; ++i) {
+      power *= 10;
+    }
+    return power;
+  }
+
+  std::string_view m_text;
+  std::size_t m_pos = 0;
+};
+
+/**
+ * Writes the integers of the text into out, in order,
+ * see integer_scanner for what counts as one.
+ *
+ * Stops once out is full, returns how many were written.
+ *
+ * @code
+ * auto robot = std::array<int, 4>{};
+ * aoc::parse_all_integers("p=0,4 v=3,-3", std::span{robot});
+ * assert(robot[3] == -3);
+ * @endcode
+ *
+ * @see string.h for the overload returning a container
+ */
+template <std::integral T, std::size_t Extent>
+constexpr std::size_t parse_all_integers(std::string_view text,
+                                         std::span<T, Extent> out) {
+  auto scanner = integer_scanner<T>{text};
+  std::size_t count = 0;
+  while ((count < out.size()) && scanner.next(out[count])) {
+    ++count;
+  }
+  return count;
+}
+
+/// A string literal as a template argument
+template <std::size_t N>
+struct fixed_string {
+  char chars[N] = {};
+
+  consteval fixed_string(const char (&str)[N]) {
+    std::ranges::copy(str, chars);
+  }
+
+  constexpr std::string_view view() const { return {chars, N - 1}; }
+};
+
+namespace detail {
+
+struct pattern_literal {
+  std::size_t pos;
+  std::size_t size;
+};
+
+/// The text around the "{}" of a scan pattern, one more than there are fields
+template <fixed_string Pattern>
+consteval auto scan_literals() {
+  // Indexed rather than searched through a string_view,
+  // GCC does not compare pointers into a template argument at compile time
+  constexpr auto size = std::size(Pattern.chars) - 1;
+  constexpr auto is_field = [](std::size_t pos) {
+    return (pos + 1 < size) && (Pattern.chars[pos] == '{') &&
+           (Pattern.chars[pos + 1] == '}');
+  };
+  constexpr auto num_fields = [&] {
+    std::size_t count = 0;
+    for (std::size_t pos = 0; pos < size; ++pos) {
+      if (is_field(pos)) {
+        ++count;
+        ++pos;
+      }
+    }
+    return count;
+  }();
+  auto literals = std::array<pattern_literal, num_fields + 1>{};
+  std::size_t start = 0;
+  for (auto& literal : literals) {
+    auto end = start;
+    while ((end < size) && !is_field(end)) {
+      ++end;
+    }
+    literal = {.pos = start, .size = end - start};
+    start = end + 2;
+  }
+  return literals;
+}
+
+template <fixed_string Pattern>
+consteval bool scan_fields_separated() {
+  const auto literals = scan_literals<Pattern>();
+  for (std::size_t i = 1; (i + 1) < literals.size(); ++i) {
+    if (literals[i].size == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <fixed_string Pattern>
+constexpr std::string_view scan_literal(std::size_t index) {
+  constexpr auto literals = scan_literals<Pattern>();
+  return Pattern.view().substr(literals[index].pos, literals[index].size);
+}
+
+[[noreturn]] inline void scan_mismatch(std::string_view text) {
+  throw std::runtime_error("scan failed to match " + std::string(text));
+}
+
+constexpr void scan_expect(std::string_view& rest, std::string_view literal) {
+  if (!rest.starts_with(literal)) [[unlikely]] {
+    scan_mismatch(rest);
+  }
+  rest.remove_prefix(literal.size());
+}
+
+/// Up to the literal after the field, or the end when that one is empty
+template <class T>
+constexpr T scan_field(std::string_view& rest, std::string_view next_literal) {
+  if constexpr (std::same_as<T, char>) {
+    if (rest.empty()) [[unlikely]] {
+      scan_mismatch(rest);
+    }
+    const char c = rest.front();
+    rest.remove_prefix(1);
+    return c;
+  } else if constexpr (std::integral<T> || std::floating_point<T>) {
+    if (rest.empty()) [[unlikely]] {
+      scan_mismatch(rest);
+    }
+    const auto [value, after] = to_number_with_rest<T>(rest);
+    rest = after;
+    return value;
+  } else {
+    static_assert(std::constructible_from<T, std::string_view>,
+                  "scan supports numbers, char and strings");
+    const auto end =
+        next_literal.empty() ? rest.size() : rest.find(next_literal);
+    if (end == std::string_view::npos) [[unlikely]] {
+      scan_mismatch(rest);
+    }
+    auto value = T{rest.substr(0, end)};
+    rest.remove_prefix(end);
+    return value;
+  }
+}
+
+template <fixed_string Pattern, class... Ts, std::size_t... Is>
+constexpr std::tuple<Ts...> scan_impl(std::string_view text,
+                                      std::index_sequence<Is...>) {
+  auto rest = text;
+  scan_expect(rest, scan_literal<Pattern>(0));
+  auto fields = std::tuple<Ts...>{};
+  // The comma fold keeps the fields in order
+  ((std::get<Is>(fields) =
+        scan_field<Ts>(rest, scan_literal<Pattern>(Is + 1)),
+    scan_expect(rest, scan_literal<Pattern>(Is + 1))),
+   ...);
+  if (!rest.empty()) [[unlikely]] {
+    scan_mismatch(text);
+  }
+  return fields;
+}
+
+} // namespace detail
+
+/**
+ * Pulls the fields out of a line following a fixed template,
+ * where every "{}" of the pattern is a field and the rest has to match.
+ *
+ * Fields are numbers (signed ones take a '-'), single chars,
+ * or strings running up to the text that follows them.
+ * The pattern is taken apart at compile time,
+ * what is left for runtime is comparing its text and parsing the numbers.
+ * Throws std::runtime_error when the line does not match.
+ *
+ * @code
+ * let [x, y, dx, dy] = aoc::scan<"p={},{} v={},{}", int, int, int, int>(line);
+ * @endcode
+ */
+template <fixed_string Pattern, class... Ts>
+constexpr std::tuple<Ts...> scan(std::string_view text) {
+  static_assert(detail::scan_literals<Pattern>().size() == sizeof...(Ts) + 1,
+                "Every {} of the pattern needs a type, and nothing else");
+  static_assert(detail::scan_fields_separated<Pattern>(),
+                "Fields need some text between them to tell them apart");
+  return detail::scan_impl<Pattern, Ts...>(
+      text, std::index_sequence_for<Ts...>{});
+}
+
+static_assert(std::tuple{2, -18, -2, 15} ==
+              scan<"Sensor at x={}, y={}: closest beacon is at x={}, y={}",
+                   int, int, int, int>(
+                  "Sensor at x=2, y=-18: closest beacon is at x=-2, y=15"));
+static_assert(std::tuple{std::string_view{"fwd"}, 'x', 3u} ==
+              scan<"{} {}={}", std::string_view, char, unsigned>("fwd x=3"));
+
 /**
  * Converts a range representing a binary number to a single decimal number.
  *
@@ -0,0 +1,327 @@
+#ifndef AOC_PARSE_CACHE_H
+#define AOC_PARSE_CACHE_H
+
+// Keeps what parse() returned for an input in a binary file,
+// so a rerun on the same input reads that back instead of parsing again.
+//
+// Not part of the module: it reads the harness options,
+// and like harness.h it is only ever included from common.h.
+//
+// Opt-in, with AOC_PARSE_CACHE naming the directory the snapshots go to,
+// see AOC_CACHED_PARSE.
+
+#include "compiler.h"
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#endif
+
+/**
+ * Names the members a snapshot is made of, for a type that is not
+ * trivially copyable, like a struct holding a few Vecs.
+ *
+ * @code
+ * struct Input {
+ *   Vec<Workflow> workflows;
+ *   Vec<Part> parts;
+ *   AOC_SNAPSHOT_FIELDS(workflows, parts)
+ * };
+ * @endcode
+ */
+#define AOC_SNAPSHOT_FIELDS(...)                                               \
+  constexpr auto aoc_snapshot_fields() { return std::tie(__VA_ARGS__); }       \
+  constexpr auto aoc_snapshot_fields() const { return std::tie(__VA_ARGS__); }
+
+namespace aoc {
+
+namespace detail {
+
+/// Written as its size and its elements.
+/// A static_vector is tuple-like as well, this has to be checked first.
+template <class T>
+concept resizable_contiguous =
+    std::ranges::contiguous_range<T> &&
+    requires(T& container, std::size_t size) { container.resize(size); };
+
+} // namespace detail
+
+/**
+ * What a snapshot can hold:
+ * - trivially copyable types, static_vector and std::array of them included,
+ *   as their bytes - except pointers and string_views into the input,
+ *   which would point nowhere on the next run
+ * - std::pair and std::tuple of snapshottable types
+ * - types naming their members with AOC_SNAPSHOT_FIELDS
+ * - types turning into something snapshottable and back,
+ *   with `aoc_to_snapshot() const` and a static `aoc_from_snapshot`,
+ *   like name_to_id
+ * - flat_map of snapshottable keys and values
+ * - std::vector, std::string and static_vector of snapshottable types
+ *
+ * Only checked one level deep, like hash_combinable,
+ * the element types are checked as they are written.
+ */
+template <class T>
+concept snapshottable =
+    requires(T& value) { value.aoc_snapshot_fields(); } ||
+    requires(const T& value) {
+      T::aoc_from_snapshot(value.aoc_to_snapshot());
+    } ||
+    (std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> &&
+     !std::same_as<T, std::string_view>) ||
+    requires { std::tuple_size<T>::value; } ||
+    requires(T& map) {
+      map.keys();
+      map.values();
+    } ||
+    detail::resizable_contiguous<T>;
+
+namespace detail {
+
+class snapshot_writer {
+ public:
+  template <snapshottable T>
+  void write(const T& value) {
+    if constexpr (requires { value.aoc_snapshot_fields(); }) {
+      std::apply([&](const auto&... fields) { (write(fields), ...); },
+                 value.aoc_snapshot_fields());
+    } else if constexpr (requires { value.aoc_to_snapshot(); }) {
+      write(value.aoc_to_snapshot());
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+      write_bytes(&value, sizeof(T));
+    } else if constexpr (resizable_contiguous<T>) {
+      write(static_cast<std::uint64_t>(std::ranges::size(value)));
+      using element_t = std::ranges::range_value_t<T>;
+      if constexpr (std::is_trivially_copyable_v<element_t>) {
+        write_bytes(std::ranges::data(value),
+                    std::ranges::size(value) * sizeof(element_t));
+      } else {
+        for (const auto& element : value) {
+          write(element);
+        }
+      }
+    } else if constexpr (requires { std::tuple_size<T>::value; }) {
+      std::apply([&](const auto&... members) { (write(members), ...); },
+                 value);
+    } else {
+      write(value.keys());
+      write(value.values());
+    }
+  }
+
+  std::string_view bytes() const { return m_bytes; }
+
+ private:
+  void write_bytes(const void* data, std::size_t size) {
+    m_bytes.append(static_cast<const char*>(data), size);
+  }
+
+  std::string m_bytes;
+};
+
+/// Reads back what snapshot_writer wrote, false on running out of bytes
+class snapshot_reader {
+ public:
+  explicit snapshot_reader(std::string_view bytes) : m_bytes{bytes} {}
+
+  template <snapshottable T>
+  bool read(T& value) {
+    if constexpr (requires { value.aoc_snapshot_fields(); }) {
+      return std::apply([&](auto&... fields) { return (read(fields) && ...); },
+                        value.aoc_snapshot_fields());
+    } else if constexpr (requires { value.aoc_to_snapshot(); }) {
+      auto snapshot = decltype(value.aoc_to_snapshot()){};
+      if (!read(snapshot)) {
+        return false;
+      }
+      value = T::aoc_from_snapshot(std::move(snapshot));
+      return true;
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+      return read_bytes(&value, sizeof(T));
+    } else if constexpr (resizable_contiguous<T>) {
+      auto size = std::uint64_t{};
+      // More than a static_vector holds could only come from a bad file
+      if (!read(size) || (size > value.max_size())) {
+        return false;
+      }
+      using element_t = std::ranges::range_value_t<T>;
+      if constexpr (std::is_trivially_copyable_v<element_t>) {
+        if (size > m_bytes.size() / sizeof(element_t)) {
+          return false;
+        }
+        value.resize(size);
+        return read_bytes(std::ranges::data(value), size * sizeof(element_t));
+      } else {
+        // Every element takes at least a byte, a bad size cannot allocate
+        if (size > m_bytes.size()) {
+          return false;
+        }
+        value.resize(size);
+        return std::ranges::all_of(
+            value, [&](auto& element) { return read(element); });
+      }
+    } else if constexpr (requires { std::tuple_size<T>::value; }) {
+      return std::apply(
+          [&](auto&... members) { return (read(members) && ...); }, value);
+    } else {
+      auto keys = typename T::key_container_type{};
+      auto values = typename T::mapped_container_type{};
+      if (!read(keys) || !read(values) || (keys.size() != values.size())) {
+        return false;
+      }
+      // Written from a flat_map, already sorted and unique
+      value.replace(std::move(keys), std::move(values));
+      return true;
+    }
+  }
+
+  bool done() const { return m_bytes.empty(); }
+
+ private:
+  bool read_bytes(void* data, std::size_t size) {
+    if (size > m_bytes.size()) {
+      return false;
+    }
+    if (size > 0) {
+      std::memcpy(data, m_bytes.data(), size);
+    }
+    m_bytes.remove_prefix(size);
+    return true;
+  }
+
+  std::string_view m_bytes;
+};
+
+template <class T>
+constexpr std::string_view snapshot_type_name() {
+#ifdef AOC_COMPILER_MSVC
+  return __FUNCSIG__;
+#else
+  return __PRETTY_FUNCTION__;
+#endif
+}
+
+inline constexpr std::string_view snapshot_magic = "aocsnap1";
+
+} // namespace detail
+
+namespace harness {
+
+/**
+ * parse(filename), or the snapshot of it from an earlier run.
+ *
+ * A snapshot is only used when it was taken of the same input contents,
+ * for the same type, by the same build of the test:
+ * the layout of a type can change without its name changing,
+ * so every rebuild starts over.
+ * Anything else, a missing or damaged snapshot included, parses as usual
+ * and writes a new one.
+ *
+ * Without AOC_PARSE_CACHE this is just parse(filename).
+ */
+template <class F>
+auto cached_parse(F&& parse, const std::string& filename, int year,
+                  std::string_view day, std::string_view build_stamp)
+    -> std::remove_cvref_t<std::invoke_result_t<F&, const std::string&>> {
+  using parsed_t =
+      std::remove_cvref_t<std::invoke_result_t<F&, const std::string&>>;
+  const auto& directory = get_options().parse_cache;
+  if (directory.empty()) {
+    return parse(filename);
+  }
+
+  auto key = hash_combine{};
+  {
+    // Hashing even a large input is far cheaper than parsing it
+    const auto input = mapped_file{filename};
+    key(input.view());
+    key(input.view().size());
+  }
+  key(detail::snapshot_type_name<parsed_t>());
+  key(build_stamp);
+
+  const auto stem = std::filesystem::path{filename}.filename().string();
+  const auto path = std::filesystem::path{directory} /
+                    std::format("{}_{}_{}.snapshot", year, day, stem);
+
+  const auto header_size = detail::snapshot_magic.size() + sizeof(key.seed);
+  {
+    const auto snapshot = mapped_file{path.string()};
+    const auto bytes = snapshot.view();
+    auto stored_key = decltype(key.seed){};
+    if ((bytes.size() >= header_size) &&
+        bytes.starts_with(detail::snapshot_magic)) {
+      std::memcpy(&stored_key, bytes.data() + detail::snapshot_magic.size(),
+                  sizeof(stored_key));
+    }
+    if ((bytes.size() >= header_size) && (stored_key == key.seed)) {
+      auto reader = detail::snapshot_reader{bytes.substr(header_size)};
+      auto parsed = parsed_t{};
+      if (reader.read(parsed) && reader.done()) {
+        return parsed;
+      }
+    }
+  }
+
+  auto parsed = parse(filename);
+  auto writer = detail::snapshot_writer{};
+  writer.write(parsed);
+  // Written next to it and renamed over it,
+  // a run reading it meanwhile sees either the old or the new one whole
+  auto error = std::error_code{};
+  std::filesystem::create_directories(directory, error);
+  auto temporary = path;
+  temporary += ".tmp";
+  {
+    auto file = std::ofstream{temporary, std::ios::binary};
+    file.write(detail::snapshot_magic.data(),
+               static_cast<std::streamsize>(detail::snapshot_magic.size()));
+    file.write(reinterpret_cast<const char*>(&key.seed), sizeof(key.seed));
+    file.write(writer.bytes().data(),
+               static_cast<std::streamsize>(writer.bytes().size()));
+    if (!file) {
+      // Without a snapshot the next run just parses again
+      return parsed;
+    }
+  }
+  std::filesystem::rename(temporary, path, error);
+  return parsed;
+}
+
+} // namespace harness
+
+} // namespace aoc
+
+/**
+ * Evaluates to parse(filename), with the time it took charged to parsing,
+ * read from a snapshot when AOC_PARSE_CACHE is set.
+ *
+ * @code
+ * let input = AOC_CACHED_PARSE(parse, "day11.input");
+ * @endcode
+ */
+#define AOC_CACHED_PARSE(parse, filename)                                      \
+  aoc::harness::timed_parse([&]() {                                            \
+    return aoc::harness::cached_parse(                                         \
+        [&](const std::string& parsed_filename) {                              \
+          return parse(parsed_filename);                                       \
+        },                                                                     \
+        (filename), AOC_YEAR, AOC_DAY, __DATE__ " " __TIME__);                 \
+  })
+
+#endif // AOC_PARSE_CACHE_H
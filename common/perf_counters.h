@@ -0,0 +1,274 @@
+#ifndef AOC_PERF_COUNTERS_H
+#define AOC_PERF_COUNTERS_H
+
+// Hardware performance counters around a region of code,
+// wall time alone does not tell a memory-bound loop from a branch-bound one.
+//
+// Not part of the module: it needs the Linux headers directly.
+// Like harness.h it is only ever included from common.h,
+// once the standard library is in by whichever route that took.
+// The Linux headers are plain C, they do not clash with `import std`.
+//
+// Only perf_event_open on Linux is supported.
+// Anywhere else, or when the kernel refuses -
+// containers commonly do, so does a perf_event_paranoid above 2 -
+// the counters read as unavailable and only the wall time is reported.
+
+#include "compiler.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define AOC_PERF_COUNTERS_SUPPORTED
+#endif
+
+#ifndef AOC_IMPORT_STD
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+#include <system_error>
+#endif
+
+namespace aoc {
+
+enum class perf_event : std::uint8_t {
+  cycles,
+  instructions,
+  l1d_misses,
+  llc_misses,
+  branch_misses,
+};
+
+inline constexpr std::size_t num_perf_events = 5;
+
+/// Counts read back from perf_counters, empty where a counter is unavailable.
+struct perf_sample {
+  std::array<std::optional<std::uint64_t>, num_perf_events> counts;
+
+  std::optional<std::uint64_t> operator[](perf_event event) const {
+    return counts[static_cast<std::size_t>(event)];
+  }
+
+  /// Instructions per cycle
+  std::optional<double> ipc() const {
+    const auto cycles = (*this)[perf_event::cycles];
+    const auto instructions = (*this)[perf_event::instructions];
+    if (!cycles || !instructions || (*cycles == 0)) {
+      return {};
+    }
+    return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+  }
+};
+
+/**
+ * Opens one counter per perf_event for the calling thread, user space only.
+ *
+ * The counters are opened one by one rather than as a group,
+ * so a machine without, say, an L1d miss event still reports the others.
+ * When the PMU has fewer counters than requested the kernel multiplexes them,
+ * the counts are scaled up by the fraction of time each one was running.
+ * Work done by other threads is not counted.
+ */
+class perf_counters {
+ public:
+  perf_counters() {
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+    for (std::size_t i = 0; i < num_perf_events; ++i) {
+      fds_[i] = open_event(static_cast<perf_event>(i));
+      if ((fds_[i] < 0) && (error_ == 0)) {
+        error_ = errno;
+      }
+    }
+#endif
+  }
+
+  ~perf_counters() {
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+#endif
+  }
+
+  perf_counters(const perf_counters&) = delete;
+  perf_counters& operator=(const perf_counters&) = delete;
+
+  /// Whether at least one counter could be opened
+  bool available() const {
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Why the first counter that failed to open did, empty if none did
+  std::string error() const {
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+    if (error_ != 0) {
+      return std::generic_category().message(error_);
+    }
+    return {};
+#else
+    return "not supported on this platform";
+#endif
+  }
+
+  void start() {
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+#endif
+  }
+
+  void stop() {
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+    for (const int fd : fds_) {
+      if (fd >= 0) {
+        ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+#endif
+  }
+
+  perf_sample read() const {
+    auto sample = perf_sample{};
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+    for (std::size_t i = 0; i < num_perf_events; ++i) {
+      if (fds_[i] < 0) {
+        continue;
+      }
+      // Layout given by read_format in open_event
+      struct {
+        std::uint64_t value;
+        std::uint64_t time_enabled;
+        std::uint64_t time_running;
+      } data{};
+      if (::read(fds_[i], &data, sizeof(data)) != sizeof(data)) {
+        continue;
+      }
+      if (data.time_running == 0) {
+        // Never got scheduled onto the PMU, there is nothing to scale
+        continue;
+      }
+      auto value = data.value;
+      if (data.time_running < data.time_enabled) {
+        value = static_cast<std::uint64_t>(
+            static_cast<double>(value) *
+            static_cast<double>(data.time_enabled) /
+            static_cast<double>(data.time_running));
+      }
+      sample.counts[i] = value;
+    }
+#endif
+    return sample;
+  }
+
+ private:
+#ifdef AOC_PERF_COUNTERS_SUPPORTED
+  static int open_event(perf_event event) {
+    auto attr = perf_event_attr{};
+    attr.size = sizeof(attr);
+    switch (event) {
+      case perf_event::cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case perf_event::instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case perf_event::l1d_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D |
+                      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+      case perf_event::llc_misses:
+        // The generic cache miss event is the last level cache on most PMUs
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case perf_event::branch_misses:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    }
+    attr.disabled = 1;
+    // Excluding the kernel is what an unprivileged process is allowed
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+        PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1,
+                                      PERF_FLAG_FD_CLOEXEC));
+  }
+#endif
+
+  std::array<int, num_perf_events> fds_{-1, -1, -1, -1, -1};
+  int error_ = 0;
+};
+
+/**
+ * Like scoped_timer, but also reports the hardware counters.
+ *
+ * Opening the counters takes a few system calls,
+ * which happen before the clock starts.
+ */
+class scoped_counters {
+ public:
+  scoped_counters(std::string_view msg = "") {
+    if (!msg.empty()) {
+      std::println("Counters: {}", msg);
+    }
+    counters_.start();
+    timer_.start();
+  }
+
+  ~scoped_counters() {
+    timer_.stop();
+    counters_.stop();
+    if (!counters_.available()) {
+      std::println("{:.3f} ms (no performance counters: {})",
+                   timer_.milliseconds(), counters_.error());
+      return;
+    }
+
+    const auto sample = counters_.read();
+    const auto count = [&](perf_event event) -> std::string {
+      const auto value = sample[event];
+      return value ? std::to_string(*value) : std::string{"n/a"};
+    };
+    const auto ipc = sample.ipc();
+    std::println("{:.3f} ms, {} cycles, {} instructions, IPC {}, "
+                 "{} L1d misses, {} LLC misses, {} branch misses",
+                 timer_.milliseconds(), count(perf_event::cycles),
+                 count(perf_event::instructions),
+                 ipc ? std::format("{:.2f}", *ipc) : std::string{"n/a"},
+                 count(perf_event::l1d_misses), count(perf_event::llc_misses),
+                 count(perf_event::branch_misses));
+  }
+
+ private:
+  perf_counters counters_;
+  timer timer_;
+};
+
+} // namespace aoc
+
+#endif // AOC_PERF_COUNTERS_H
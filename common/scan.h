@@ -0,0 +1,234 @@
+#ifndef AOC_SCAN_H
+#define AOC_SCAN_H
+
+#include "compiler.h"
+
+#ifndef AOC_MODULE_SUPPORT
+#ifdef AOC_ARCH_X86_64
+#include <immintrin.h>
+#ifdef AOC_COMPILER_MSVC
+#include <intrin.h>
+#endif
+#endif
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+#endif
+#endif
+
+#if defined(AOC_ARCH_X86_64) && !defined(AOC_COMPILER_MSVC)
+#define AOC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+// MSVC takes AVX2 intrinsics anywhere, it is on us to check the CPU first
+#define AOC_TARGET_AVX2
+#endif
+
+AOC_EXPORT_NAMESPACE(aoc) {
+
+namespace detail {
+
+/// Bit i is set when the character at i matches, for a block of 64 of them
+using scan_mask = std::uint64_t;
+inline constexpr std::size_t scan_block_size = 64;
+
+constexpr scan_mask scan_block_scalar(const char* block, std::size_t size,
+                                      char needle) {
+  scan_mask mask = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    mask |= static_cast<scan_mask>(block[i] == needle) << i;
+  }
+  return mask;
+}
+
+#ifdef AOC_ARCH_X86_64
+
+// x86-64 always has SSE2
+inline scan_mask scan_block_sse2(const char* block, char needle) {
+  const auto needles = _mm_set1_epi8(needle);
+  scan_mask mask = 0;
+  for (std::size_t i = 0; i < scan_block_size; i += 16) {
+    const auto chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+    const auto matches = static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(chars, needles)));
+    mask |= static_cast<scan_mask>(matches) << i;
+  }
+  return mask;
+}
+
+AOC_TARGET_AVX2 inline scan_mask scan_block_avx2(const char* block,
+                                                 char needle) {
+  const auto needles = _mm256_set1_epi8(needle);
+  const auto low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+  const auto high =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+  const auto low_matches = static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(low, needles)));
+  const auto high_matches = static_cast<std::uint32_t>(
+      _mm256_movemask_epi8(_mm256_cmpeq_epi8(high, needles)));
+  return (static_cast<scan_mask>(high_matches) << 32) | low_matches;
+}
+
+inline bool cpu_has_avx2() {
+#ifdef AOC_COMPILER_MSVC
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  // The OS has to save the YMM registers too, not just the CPU have them
+  const bool avx = (info[2] & (1 << 28)) != 0;
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  __cpuidex(info, 7, 0);
+  const bool avx2 = (info[1] & (1 << 5)) != 0;
+  return avx && osxsave && avx2 && ((_xgetbv(0) & 0b110) == 0b110);
+#else
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif // AOC_ARCH_X86_64
+
+using scan_block_fn = scan_mask (*)(const char*, char);
+
+inline scan_mask scan_block_portable(const char* block, char needle) {
+  return scan_block_scalar(block, scan_block_size, needle);
+}
+
+/// Picked once, on first use, for the CPU the process runs on
+inline scan_block_fn get_scan_block() {
+#ifdef AOC_ARCH_X86_64
+  static const scan_block_fn scan_block =
+      cpu_has_avx2() ? &scan_block_avx2 : &scan_block_sse2;
+  return scan_block;
+#else
+  return &scan_block_portable;
+#endif
+}
+
+constexpr scan_mask scan_block(const char* block, std::size_t size,
+                               char needle) {
+  if (std::is_constant_evaluated() || (size < scan_block_size)) {
+    return scan_block_scalar(block, size, needle);
+  }
+  return get_scan_block()(block, needle);
+}
+
+} // namespace detail
+
+/**
+ * The positions of one character in a string, found 64 at a time.
+ *
+ * Each block of the string is compared at once into a bitmask
+ * (AVX2 or SSE2 on x86-64, whichever the CPU has),
+ * then the positions are walked off the mask without touching it again.
+ * Against a find per position that pays off as soon as they are close,
+ * like the ends of the short lines and fields of a puzzle input.
+ *
+ * Usable at compile time, where it compares one character at a time.
+ */
+class char_positions_view
+    : public std::ranges::view_interface<char_positions_view> {
+ public:
+  class iterator {
+   public:
+    using value_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr iterator() = default;
+    constexpr iterator(std::string_view text, char needle)
+        : m_text{text}, m_needle{needle} {
+      m_remaining = detail::scan_block(m_text.data(), block_length(), m_needle);
+      seek_next_block();
+    }
+
+    constexpr std::size_t operator*() const {
+      return m_block_start +
+             static_cast<std::size_t>(std::countr_zero(m_remaining));
+    }
+
+    constexpr iterator& operator++() {
+      // Clearing the lowest set bit leaves the rest of the block to walk
+      m_remaining &= (m_remaining - 1);
+      seek_next_block();
+      return *this;
+    }
+    constexpr iterator operator++(int) {
+      auto previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    constexpr bool operator==(const iterator& other) const {
+      return (m_block_start == other.m_block_start) &&
+             (m_remaining == other.m_remaining);
+    }
+    constexpr bool operator==(std::default_sentinel_t) const {
+      return m_block_start >= m_text.size();
+    }
+
+   private:
+    constexpr std::size_t block_length() const {
+      return std::ranges::min(detail::scan_block_size,
+                              m_text.size() - m_block_start);
+    }
+
+    constexpr void seek_next_block() {
+      while ((m_remaining == 0) && (m_block_start < m_text.size())) {
+        m_block_start += detail::scan_block_size;
+        if (m_block_start >= m_text.size()) {
+          m_block_start = m_text.size();
+          return;
+        }
+        m_remaining = detail::scan_block(m_text.data() + m_block_start,
+                                         block_length(), m_needle);
+      }
+    }
+
+    std::string_view m_text;
+    char m_needle = '\0';
+    std::size_t m_block_start = 0;
+    detail::scan_mask m_remaining = 0;
+  };
+
+  constexpr char_positions_view() = default;
+  constexpr char_positions_view(std::string_view text, char needle)
+      : m_text{text}, m_needle{needle} {}
+
+  constexpr iterator begin() const { return iterator{m_text, m_needle}; }
+  constexpr std::default_sentinel_t end() const { return {}; }
+
+ private:
+  std::string_view m_text;
+  char m_needle = '\0';
+};
+
+namespace views {
+
+constexpr auto char_positions(std::string_view text, char needle) {
+  return char_positions_view{text, needle};
+}
+
+} // namespace views
+
+static_assert(std::ranges::equal(
+    std::array<std::size_t, 3>{1, 3, 69},
+    views::char_positions(
+        std::string_view{"a\nb\n"
+                         "................................................."
+                         "................\nc"},
+        '\n')));
+static_assert(std::ranges::empty(views::char_positions("abc", '\n')));
+static_assert(std::ranges::empty(views::char_positions("", '\n')));
+
+} // AOC_EXPORT_NAMESPACE(aoc)
+
+#endif // AOC_SCAN_H
@@ -0,0 +1,428 @@
+#ifndef AOC_SMALL_VECTOR_H
+#define AOC_SMALL_VECTOR_H
+
+#include "assert.h"
+#include "compiler.h"
+#include "hash.h"
+#include "range_to.h"
+#include "static_vector.h"
+
+#ifndef AOC_MODULE_SUPPORT
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#endif
+#endif
+
+AOC_EXPORT_NAMESPACE(aoc) {
+
+/**
+ * A vector holding up to N elements inline,
+ * that moves them to the heap only once it grows past that.
+ *
+ * For sizes that depend on the input:
+ * pick N for the inputs seen so far and those never allocate,
+ * like a static_vector, but a larger input spills instead of asserting.
+ *
+ * Unlike a static_vector, a copy is never a plain copy of the object:
+ * the elements may be elsewhere.
+ * Usable at compile time, where it always allocates,
+ * constant evaluation cannot construct the inline elements one at a time.
+ *
+ * @code
+ * // Nodes of the inputs have at most 13 neighbors, no allocation for those
+ * using Connections = aoc::small_vector<i32, 13>;
+ * @endcode
+ */
+template <class T, std::size_t N>
+class small_vector {
+  static_assert(N > 0, "A Vec is a small_vector without inline elements");
+
+ public:
+  using value_type = T;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using size_type = std::size_t;
+  using difference_type = std::make_signed_t<size_type>;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  constexpr small_vector() noexcept = default;
+
+  constexpr small_vector(const small_vector& other) {
+    this->append(other.begin(), other.end());
+  }
+  /// Takes the allocation of a spilled vector, moves the inline elements
+  constexpr small_vector(small_vector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    this->take(std::move(other));
+  }
+  constexpr small_vector& operator=(const small_vector& other) {
+    if (this != &other) {
+      this->clear();
+      this->append(other.begin(), other.end());
+    }
+    return *this;
+  }
+  constexpr small_vector& operator=(small_vector&& other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &other) {
+      this->clear();
+      this->deallocate();
+      this->take(std::move(other));
+    }
+    return *this;
+  }
+
+  constexpr ~small_vector() {
+    this->clear();
+    this->deallocate();
+  }
+
+  constexpr explicit small_vector(size_type n) { this->resize(n); }
+  constexpr small_vector(size_type n, const value_type& value) {
+    this->resize(n, value);
+  }
+  template <std::input_iterator I, std::sentinel_for<I> S>
+  constexpr small_vector(I first, S last) {
+    this->append(std::move(first), std::move(last));
+  }
+  constexpr small_vector(std::initializer_list<value_type> il)
+      : small_vector(std::ranges::begin(il), std::ranges::end(il)) {}
+
+  template <std::ranges::range R>
+  // requires (container-compatible-range<R, T>)
+  constexpr small_vector(ranges::from_range_t, R&& rg)
+      : small_vector(std::ranges::begin(rg), std::ranges::end(rg)) {}
+
+  // Iterators
+  constexpr iterator begin() noexcept { return m_data; }
+  constexpr const_iterator begin() const noexcept { return m_data; }
+  constexpr iterator end() noexcept { return m_data + m_size; }
+  constexpr const_iterator end() const noexcept { return m_data + m_size; }
+  constexpr reverse_iterator rbegin() noexcept {
+    return reverse_iterator{this->end()};
+  }
+  constexpr const_reverse_iterator rbegin() const noexcept {
+    return const_reverse_iterator{this->end()};
+  }
+  constexpr reverse_iterator rend() noexcept {
+    return reverse_iterator{this->begin()};
+  }
+  constexpr const_reverse_iterator rend() const noexcept {
+    return const_reverse_iterator{this->begin()};
+  }
+  constexpr const_iterator cbegin() const noexcept { return this->begin(); }
+  constexpr const_iterator cend() const noexcept { return this->end(); }
+  constexpr const_reverse_iterator crbegin() const noexcept {
+    return this->rbegin();
+  }
+  constexpr const_reverse_iterator crend() const noexcept {
+    return this->rend();
+  }
+
+  // Comparison
+  constexpr bool operator==(small_vector const& other) const {
+    return std::ranges::equal(*this, other);
+  }
+
+  // Size/capacity:
+  constexpr bool empty() const noexcept { return m_size == 0; }
+  constexpr size_type size() const noexcept { return m_size; }
+  constexpr size_type max_size() const noexcept {
+    return std::allocator_traits<std::allocator<T>>::max_size(
+        std::allocator<T>{});
+  }
+  constexpr size_type capacity() const noexcept {
+    // Nothing is held yet, but the inline elements are there to take
+    if (!std::is_constant_evaluated() && (m_data == nullptr)) {
+      return N;
+    }
+    return m_capacity;
+  }
+  static constexpr size_type inline_capacity() noexcept { return N; }
+  /// Whether the elements are still held inline, none were ever spilled
+  constexpr bool is_inline() const noexcept { return !this->on_heap(); }
+
+  constexpr void reserve(size_type n) {
+    if (n > m_capacity) {
+      this->grow(n);
+    }
+  }
+  /// New elements are value-initialized
+  constexpr void resize(size_type sz) {
+    this->destroy_from(std::ranges::min(sz, m_size));
+    this->reserve(sz);
+    while (m_size < sz) {
+      this->emplace_back();
+    }
+  }
+  constexpr void resize(size_type sz, const value_type& c) {
+    this->destroy_from(std::ranges::min(sz, m_size));
+    if (sz > m_capacity) {
+      // c may be one of the elements that are about to move
+      const auto value = c;
+      this->reserve(sz);
+      while (m_size < sz) {
+        this->emplace_back(value);
+      }
+      return;
+    }
+    while (m_size < sz) {
+      this->emplace_back(c);
+    }
+  }
+
+  // Element and data access:
+  constexpr reference operator[](size_type n) {
+    AOC_ASSERT(n < m_size, "Out of bounds access on subscript op");
+    return m_data[n];
+  }
+  constexpr const_reference operator[](size_type n) const {
+    AOC_ASSERT(n < m_size, "Out of bounds access on subscript op");
+    return m_data[n];
+  }
+  constexpr reference front() {
+    AOC_ASSERT(m_size > 0, "No elements for front");
+    return m_data[0];
+  }
+  constexpr const_reference front() const {
+    AOC_ASSERT(m_size > 0, "No elements for front");
+    return m_data[0];
+  }
+  constexpr reference back() {
+    AOC_ASSERT(m_size > 0, "No elements for back");
+    return m_data[m_size - 1];
+  }
+  constexpr const_reference back() const {
+    AOC_ASSERT(m_size > 0, "No elements for back");
+    return m_data[m_size - 1];
+  }
+  constexpr T* data() noexcept { return m_data; }
+  constexpr const T* data() const noexcept { return m_data; }
+
+  // Add elements
+  template <class... Args>
+  constexpr reference emplace_back(Args&&... args) {
+    if (m_size == m_capacity) {
+      if (std::is_constant_evaluated() || (m_data != nullptr)) {
+        return this->spill_and_emplace_back(std::forward<Args>(args)...);
+      }
+      this->use_inline();
+    }
+    auto* element =
+        std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+    ++m_size;
+    return *element;
+  }
+  constexpr void push_back(const value_type& x) { this->emplace_back(x); }
+  constexpr void push_back(value_type&& x) {
+    this->emplace_back(std::move(x));
+  }
+
+  // Remove elements
+  constexpr void pop_back() {
+    AOC_ASSERT(m_size > 0, "No element to pop");
+    this->destroy_from(m_size - 1);
+  }
+
+  constexpr iterator erase(const_iterator position) {
+    auto nc_pos = begin() + std::distance(cbegin(), position);
+    std::ranges::move(nc_pos + 1, end(), nc_pos);
+    this->destroy_from(m_size - 1);
+    return nc_pos;
+  }
+
+  constexpr iterator erase(const_iterator first, const_iterator last) {
+    auto nc_first = begin() + std::distance(cbegin(), first);
+    auto nc_last = begin() + std::distance(cbegin(), last);
+    std::ranges::move(nc_last, end(), nc_first);
+    this->destroy_from(m_size - static_cast<size_type>(nc_last - nc_first));
+    return nc_first;
+  }
+
+  /// Keeps the capacity, like Vec
+  constexpr void clear() noexcept { this->destroy_from(0); }
+
+  constexpr iterator insert(const_iterator pos, const T& value) {
+    const auto index = std::distance(cbegin(), pos);
+    this->push_back(value);
+    // rotate_right
+    std::ranges::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+  constexpr iterator insert(const_iterator pos, T&& value) {
+    const auto index = std::distance(cbegin(), pos);
+    this->push_back(std::move(value));
+    std::ranges::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+
+ private:
+  constexpr T* inline_data() noexcept { return m_inline.elements; }
+
+  constexpr bool on_heap() const noexcept {
+    if (std::is_constant_evaluated()) {
+      return m_data != nullptr;
+    }
+    return (m_data != nullptr) && (m_data != m_inline.elements);
+  }
+
+  constexpr void use_inline() noexcept {
+    m_data = this->inline_data();
+    m_capacity = N;
+  }
+
+  template <class I, class S>
+  constexpr void append(I first, S last) {
+    if constexpr (std::sized_sentinel_for<S, I>) {
+      const auto count = static_cast<size_type>(last - first);
+      this->reserve(m_size + count);
+      if (!std::is_constant_evaluated()) {
+        // Room for all of them, copied in one go, a memmove for trivial T
+        std::uninitialized_copy_n(std::move(first), count, this->end());
+        m_size += count;
+        return;
+      }
+    }
+    for (; first != last; ++first) {
+      this->emplace_back(*first);
+    }
+  }
+
+  /// Moves the elements to where n of them fit, the heap unless they fit inline
+  constexpr void grow(size_type n) {
+    if (!std::is_constant_evaluated() && (m_data == nullptr) && (n <= N)) {
+      this->use_inline();
+      return;
+    }
+    auto allocator = std::allocator<T>{};
+    auto* grown = allocator.allocate(n);
+    this->relocate_to(grown, n);
+  }
+
+  /// The new element is constructed first, args may refer to an old one
+  template <class... Args>
+  constexpr reference spill_and_emplace_back(Args&&... args) {
+    const auto new_capacity = std::ranges::max(2 * m_capacity, N);
+    auto allocator = std::allocator<T>{};
+    auto* grown = allocator.allocate(new_capacity);
+    std::construct_at(grown + m_size, std::forward<Args>(args)...);
+    this->relocate_to(grown, new_capacity);
+    ++m_size;
+    return this->back();
+  }
+
+  constexpr void relocate_to(T* grown, size_type new_capacity) {
+    for (size_type i = 0; i < m_size; ++i) {
+      std::construct_at(grown + i, std::move_if_noexcept(m_data[i]));
+      std::destroy_at(m_data + i);
+    }
+    this->deallocate();
+    m_data = grown;
+    m_capacity = new_capacity;
+  }
+
+  constexpr void deallocate() noexcept {
+    if (this->on_heap()) {
+      std::allocator<T>{}.deallocate(m_data, m_capacity);
+    }
+    m_data = nullptr;
+    m_capacity = 0;
+  }
+
+  /// Empty and with no allocation to take over the elements of other
+  constexpr void take(small_vector&& other) {
+    if (other.on_heap()) {
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+      m_capacity = std::exchange(other.m_capacity, 0);
+      return;
+    }
+    this->append(std::make_move_iterator(other.begin()),
+                 std::make_move_iterator(other.end()));
+    other.clear();
+  }
+
+  /// Shrinks to new_size, ending the lifetime of the elements past it
+  constexpr void destroy_from(size_type new_size) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      std::destroy(m_data + new_size, m_data + m_size);
+    }
+    m_size = new_size;
+  }
+
+  // Either the inline elements or a heap allocation,
+  // null until the first element needs a place
+  T* m_data = nullptr;
+  size_type m_size = 0;
+  size_type m_capacity = 0;
+  detail::uninitialized_array<T, N> m_inline{};
+};
+
+#ifndef AOC_COMPILER_MSVC
+static_assert([] {
+  auto vec = small_vector<int, 2>{2, 4, 6};
+  vec.insert(vec.begin() + 1, 42);
+  vec.erase(vec.begin());
+  return std::ranges::equal(std::array{42, 4, 6}, vec);
+}());
+#endif
+
+namespace detail {
+
+template <class T>
+struct is_small_vector : std::false_type {};
+
+template <class T, std::size_t N>
+struct is_small_vector<small_vector<T, N>> : std::true_type {};
+
+} // namespace detail
+
+template <class T>
+concept is_small_vector =
+    detail::is_small_vector<std::remove_cvref_t<T>>::value;
+
+template <class T, std::size_t N>
+constexpr auto collect_small_vec() {
+  return ranges::to<small_vector<T, N>>();
+}
+
+} // AOC_EXPORT_NAMESPACE(aoc)
+
+namespace std {
+
+/// Hashes the same as a static_vector of the same elements
+template <class T, std::size_t N>
+  requires std::has_unique_object_representations_v<T> ||
+           aoc::hash_combinable<T>
+struct hash<aoc::small_vector<T, N>> {
+  using is_avalanching = void;
+
+  constexpr std::size_t operator()(
+      const aoc::small_vector<T, N>& value) const {
+    return aoc::detail::hash_elements(value.data(), value.size());
+  }
+};
+
+} // namespace std
+
+AOC_EXPORT_NAMESPACE(aoc) {
+
+static_assert(hashable<small_vector<int, 4>>);
+
+} // AOC_EXPORT_NAMESPACE(aoc)
+
+#endif // AOC_SMALL_VECTOR_H
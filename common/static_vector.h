@@ -18,6 +18,7 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <string_view>
 #include <type_traits>
 #include <utility>
@@ -26,14 +27,42 @@
 
 AOC_EXPORT_NAMESPACE(aoc) {
 
+namespace detail {
+
+/// Room for N elements, each constructed and destroyed on its own
+template <class T, std::size_t N>
+union uninitialized_array {
+  constexpr uninitialized_array() noexcept {}
+  constexpr ~uninitialized_array()
+    requires std::is_trivially_destructible_v<T>
+  = default;
+  constexpr ~uninitialized_array() {}
+
+  // An array of 0 is not standard, the one element is never constructed
+  T elements[(N == 0) ? 1 : N];
+};
+
+} // namespace detail
+
 // https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2018/p0843r2.html
 // Can be replaced by std::inplace_vector in C++26
 // https://en.cppreference.com/w/cpp/container/inplace_vector.html
 template <class T, std::size_t N>
 class static_vector {
  private:
-  // Not quite the proper way to implement it, but good enough for here
-  using container_type = std::array<T, N>;
+  // Like inplace_vector, trivially copyable elements make a trivially
+  // copyable vector, copied as a whole and usable at compile time.
+  static constexpr bool trivial = std::is_trivially_copyable_v<T>;
+  // Constant evaluation cannot construct the elements of a union member
+  // one at a time, so those that can be default constructed live in an array
+  // initialized as a whole, which costs next to nothing for them.
+  // Any other element only exists from its construction to its destruction,
+  // copies and moves only touch the first size() of them.
+  static constexpr bool in_array =
+      trivial && std::is_default_constructible_v<T>;
+  using container_type =
+      std::conditional_t<in_array, std::array<T, N>,
+                         detail::uninitialized_array<T, N>>;
 
  public:
   using value_type = T;
@@ -43,35 +72,69 @@ class static_vector {
   using const_reference = const value_type&;
   using size_type = std::size_t;
   using difference_type = std::make_signed_t<size_type>;
-  using iterator = typename container_type::iterator; //[container.requirements]
-  using const_iterator =
-      typename container_type::const_iterator; // see [container.requirements]
+  using iterator = T*;             // see [container.requirements]
+  using const_iterator = const T*; // see [container.requirements]
   using reverse_iterator = std::reverse_iterator<iterator>;
   using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   // 5.2, copy/move construction:
   constexpr static_vector() noexcept = default;
 
+  constexpr static_vector(const static_vector& other)
+    requires trivial
+  = default;
   constexpr static_vector(const static_vector& other) noexcept(
-      std::is_nothrow_copy_constructible_v<value_type>) = default;
+      std::is_nothrow_copy_constructible_v<value_type>) {
+    this->assign_elements(other);
+  }
+  constexpr static_vector(static_vector&& other)
+    requires trivial
+  = default;
   constexpr static_vector(static_vector&& other) noexcept(
-      std::is_nothrow_move_constructible_v<value_type>) = default;
+      std::is_nothrow_move_constructible_v<value_type>) {
+    this->assign_elements(std::move(other));
+  }
+  constexpr static_vector& operator=(const static_vector& other)
+    requires trivial
+  = default;
   constexpr static_vector& operator=(const static_vector& other) noexcept(
-      std::is_nothrow_copy_assignable_v<value_type>) = default;
+      std::is_nothrow_copy_assignable_v<value_type> &&
+      std::is_nothrow_copy_constructible_v<value_type>) {
+    if (this != &other) {
+      this->assign_elements(other);
+    }
+    return *this;
+  }
+  constexpr static_vector& operator=(static_vector&& other)
+    requires trivial
+  = default;
   constexpr static_vector& operator=(static_vector&& other) noexcept(
-      std::is_nothrow_move_assignable_v<value_type>) = default;
+      std::is_nothrow_move_assignable_v<value_type> &&
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &other) {
+      this->assign_elements(std::move(other));
+    }
+    return *this;
+  }
+
+  constexpr ~static_vector()
+    requires trivial
+  = default;
+  constexpr ~static_vector() { this->clear(); }
 
-  constexpr explicit static_vector(size_type n) : m_size{n} {
+  constexpr explicit static_vector(size_type n) {
     this->assert_size(n);
+    this->resize(n);
   }
-  constexpr static_vector(size_type n, const value_type& value) : m_size{n} {
+  constexpr static_vector(size_type n, const value_type& value) {
     this->assert_size(n);
-    std::ranges::fill_n(std::begin(m_data), n, value);
+    this->resize(n, value);
   }
   template <std::input_iterator I, std::sentinel_for<I> S>
-  constexpr static_vector(I first, S last)
-      : m_size{static_cast<std::size_t>(std::ranges::distance(first, last))} {
-    std::ranges::copy(first, last, std::begin(m_data));
+  constexpr static_vector(I first, S last) {
+    for (; first != last; ++first) {
+      this->emplace_back(*first);
+    }
   }
   constexpr static_vector(std::initializer_list<value_type> il)
       : static_vector(std::ranges::begin(il), std::ranges::end(il)) {}
@@ -82,25 +145,29 @@ class static_vector {
       : static_vector(std::ranges::begin(rg), std::ranges::end(rg)) {}
 
   // Iterators
-  constexpr iterator begin() noexcept { return m_data.begin(); }
-  constexpr const_iterator begin() const noexcept { return m_data.begin(); }
-  constexpr iterator end() noexcept { return m_data.begin() + m_size; }
+  constexpr iterator begin() noexcept { return this->data(); }
+  constexpr const_iterator begin() const noexcept { return this->data(); }
+  constexpr iterator end() noexcept { return this->data() + m_size; }
   constexpr const_iterator end() const noexcept {
-    return m_data.begin() + m_size;
+    return this->data() + m_size;
   }
   constexpr reverse_iterator rbegin() noexcept {
-    return m_data.rbegin() + (N - m_size);
+    return reverse_iterator{this->end()};
   }
   constexpr const_reverse_iterator rbegin() const noexcept {
-    return m_data.rbegin() + (N - m_size);
+    return const_reverse_iterator{this->end()};
+  }
+  constexpr reverse_iterator rend() noexcept {
+    return reverse_iterator{this->begin()};
   }
-  constexpr reverse_iterator rend() noexcept { return m_data.rend(); }
   constexpr const_reverse_iterator rend() const noexcept {
-    return m_data.rend();
+    return const_reverse_iterator{this->begin()};
   }
-  constexpr const_iterator cbegin() noexcept { return this->begin(); }
+  constexpr const_iterator cbegin() const noexcept { return this->begin(); }
   constexpr const_iterator cend() const noexcept { return this->end(); }
-  constexpr const_reverse_iterator crbegin() noexcept { return this->rbegin(); }
+  constexpr const_reverse_iterator crbegin() const noexcept {
+    return this->rbegin();
+  }
   constexpr const_reverse_iterator crend() const noexcept {
     return this->rend();
   }
@@ -115,73 +182,91 @@ class static_vector {
   constexpr size_type size() const noexcept { return m_size; }
   static constexpr size_type max_size() noexcept { return N; }
   static constexpr size_type capacity() noexcept { return N; }
+  /// New elements are value-initialized
   constexpr void resize(size_type sz) {
-    AOC_ASSERT(sz < N, "Exceeded capacity on resize");
-    m_size = sz;
+    AOC_ASSERT(sz <= N, "Exceeded capacity on resize");
+    this->destroy_from(std::ranges::min(sz, m_size));
+    while (m_size < sz) {
+      this->emplace_back();
+    }
   }
   constexpr void resize(size_type sz, const value_type& c) {
-    const auto old_size = m_size;
-    this->resize(sz);
-    for (int i = old_size; i < sz; ++i) {
-      m_data[i] = c;
+    AOC_ASSERT(sz <= N, "Exceeded capacity on resize");
+    this->destroy_from(std::ranges::min(sz, m_size));
+    while (m_size < sz) {
+      this->emplace_back(c);
     }
   }
 
   // Element and data access:
   constexpr reference operator[](size_type n) {
     AOC_ASSERT(n < m_size, "Out of bounds access on subscript op");
-    return m_data[n];
+    return this->data()[n];
   }
   constexpr const_reference operator[](size_type n) const {
     AOC_ASSERT(n < m_size, "Out of bounds access on subscript op");
-    return m_data[n];
+    return this->data()[n];
   }
   constexpr reference front() {
     AOC_ASSERT(m_size > 0, "No elements for front");
-    return m_data[0];
+    return this->data()[0];
   }
   constexpr const_reference front() const {
     AOC_ASSERT(m_size > 0, "No elements for front");
-    return m_data[0];
+    return this->data()[0];
   }
   constexpr reference back() {
     AOC_ASSERT(m_size > 0, "No elements for back");
-    return m_data[m_size - 1];
+    return this->data()[m_size - 1];
   }
   constexpr const_reference back() const {
     AOC_ASSERT(m_size > 0, "No elements for back");
-    return m_data[m_size - 1];
+    return this->data()[m_size - 1];
+  }
+  constexpr T* data() noexcept {
+    if constexpr (in_array) {
+      return m_data.data();
+    } else {
+      return m_data.elements;
+    }
+  }
+  constexpr const T* data() const noexcept {
+    if constexpr (in_array) {
+      return m_data.data();
+    } else {
+      return m_data.elements;
+    }
   }
-  constexpr T* data() noexcept { return m_data.data(); }
-  constexpr const T* data() const noexcept { return m_data.data(); }
 
   // Add elements
   template <class... Args>
   constexpr reference emplace_back(Args&&... args) {
-    this->push_back(value_type(std::forward<Args>(args)...));
-    return this->back();
-  }
-  constexpr void push_back(const value_type& x) {
-    AOC_ASSERT(m_size < N, "Exceeded capacity on push_back");
-    m_data[m_size] = x;
+    AOC_ASSERT(m_size < N, "Exceeded capacity on emplace_back");
+    auto* element = this->data() + m_size;
+    if constexpr (in_array) {
+      // Already alive, initialized along with the whole array
+      *element = value_type(std::forward<Args>(args)...);
+    } else {
+      std::construct_at(element, std::forward<Args>(args)...);
+    }
     ++m_size;
+    return *element;
   }
+  constexpr void push_back(const value_type& x) { this->emplace_back(x); }
   constexpr void push_back(value_type&& x) {
-    AOC_ASSERT(m_size < N, "Exceeded capacity on push_back");
-    m_data[m_size] = std::move(x);
-    ++m_size;
+    this->emplace_back(std::move(x));
   }
 
   // Remove elements
   constexpr void pop_back() {
     AOC_ASSERT(m_size > 0, "No element to pop");
-    --m_size;
+    this->destroy_from(m_size - 1);
   }
 
   constexpr iterator erase(const_iterator position) {
     auto nc_pos = begin() + std::distance(cbegin(), position);
     std::ranges::move(nc_pos + 1, end(), nc_pos);
-    --m_size;
+    this->destroy_from(m_size - 1);
     return nc_pos;
   }
 
@@ -189,22 +274,24 @@ class static_vector {
     auto nc_first = begin() + std::distance(cbegin(), first);
     auto nc_last = begin() + std::distance(cbegin(), last);
     std::ranges::move(nc_last, end(), nc_first);
-    m_size -= static_cast<size_type>(nc_last - nc_first);
+    this->destroy_from(m_size - static_cast<size_type>(nc_last - nc_first));
     return nc_first;
   }
 
-  constexpr void clear() noexcept { m_size = 0; }
+  constexpr void clear() noexcept { this->destroy_from(0); }
 
   constexpr iterator insert(const_iterator pos, const T& value) {
     auto non_const_pos = begin() + std::distance(cbegin(), pos);
     this->push_back(value);
     // rotate_right
-    std::ranges::rotate(non_const_pos + 1, end(), end() - 1);
+    std::ranges::rotate(non_const_pos, end() - 1, end());
     return non_const_pos;
   }
   constexpr iterator insert(const_iterator pos, T&& value) {
-    // TODO
-    return insert(pos, value);
+    auto non_const_pos = begin() + std::distance(cbegin(), pos);
+    this->push_back(std::move(value));
+    std::ranges::rotate(non_const_pos, end() - 1, end());
+    return non_const_pos;
   }
 
  protected:
@@ -215,10 +302,38 @@ class static_vector {
   }
 
  private:
+  /// Shrinks to new_size, ending the lifetime of the elements past it
+  constexpr void destroy_from(size_type new_size) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<value_type>) {
+      std::destroy(this->data() + new_size, this->data() + m_size);
+    }
+    m_size = new_size;
+  }
+
+  /// Assigns over the elements both have, constructs or destroys the rest
+  template <class Vector>
+  constexpr void assign_elements(Vector&& other) {
+    const auto common = std::ranges::min(m_size, other.m_size);
+    for (size_type i = 0; i < common; ++i) {
+      if constexpr (std::is_lvalue_reference_v<Vector>) {
+        this->data()[i] = other.data()[i];
+      } else {
+        this->data()[i] = std::move(other.data()[i]);
+      }
+    }
+    this->destroy_from(common);
+    for (size_type i = common; i < other.m_size; ++i) {
+      if constexpr (std::is_lvalue_reference_v<Vector>) {
+        this->emplace_back(other.data()[i]);
+      } else {
+        this->emplace_back(std::move(other.data()[i]));
+      }
+    }
+  }
+
   // Value-initialized so that the elements past m_size are never indeterminate:
   // GCC rejects an object with indeterminate members
   // as the result of a constant expression.
-  // T has to be default constructible anyway in this implementation.
   container_type m_data{};
   std::size_t m_size = 0;
 };
@@ -260,6 +375,8 @@ static_assert(std::ranges::equal(std::array{2, 4},
                                  impl_test_erase_range(2, 4)));
 #endif
 
+static_assert(std::is_trivially_copyable_v<static_vector<int, 4>>);
+
 namespace detail {
 
 template <class T>
@@ -279,9 +396,40 @@ constexpr auto collect_static_vec() {
   return ranges::to<static_vector<T, N>>();
 }
 
+namespace detail {
+
+/**
+ * Hashes the elements of a contiguous container.
+ *
+ * With a unique object representation it's one wyhash pass over the bytes,
+ * which is also what hashing a string_view of them would do.
+ * Not plain trivially copyable: a padded type is trivially copyable,
+ * but two equal values may disagree on padding and would hash differently.
+ */
+template <class T>
+  requires std::has_unique_object_representations_v<T> || hash_combinable<T>
+constexpr std::size_t hash_elements(const T* data, std::size_t size) {
+  if constexpr (std::has_unique_object_representations_v<T>) {
+    // wyhash folds the length in, so {1, 2} and {1, 2, 0} differ
+    // without feeding size() separately
+    return hash_bytes(data, size * sizeof(T));
+  } else {
+    auto combine = hash_combine{};
+    // Here the size does have to go in: combining element hashes alone
+    // cannot tell {1, 2} from {1, 2, 0}
+    combine(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      combine(data[i]);
+    }
+    return combine.seed;
+  }
+}
+
+} // namespace detail
+
 template <std::size_t N, std::integral T>
 constexpr static_vector<char, N> to_chars(T value, int base = 10) {
-  auto result = static_vector<char, N>('\0', N);
+  auto result = static_vector<char, N>(N);
   const auto [end_ptr, error_code] =
       std::to_chars(result.data(), result.data() + N, value, base);
   result.resize(std::distance(result.data(), end_ptr));
@@ -298,13 +446,8 @@ struct tuple_size<aoc::static_vector<T, N>>
 
 /**
  * Hashes the live elements only:
- * pop_back() and erase() leave the old ones in storage,
+ * pop_back() and erase() leave trivially copyable ones in storage,
  * so equal vectors can differ past size() and must still hash alike.
- *
- * With a unique object representation it's one wyhash pass over the live bytes,
- * which is also what hashing a string_view of them would do.
- * Not plain trivially copyable: a padded type is trivially copyable,
- * but two equal values may disagree on padding and would hash differently.
  */
 template <class T, std::size_t N>
   requires std::has_unique_object_representations_v<T> ||
@@ -314,20 +457,7 @@ struct hash<aoc::static_vector<T, N>> {
 
   constexpr std::size_t operator()(
       const aoc::static_vector<T, N>& value) const {
-    if constexpr (std::has_unique_object_representations_v<T>) {
-      // wyhash folds the length in, so {1, 2} and {1, 2, 0} differ
-      // without feeding size() separately
-      return aoc::hash_bytes(value.data(), value.size() * sizeof(T));
-    } else {
-      auto combine = aoc::hash_combine{};
-      // Here the size does have to go in: combining element hashes alone
-      // cannot tell {1, 2} from {1, 2, 0}
-      combine(value.size());
-      for (const auto& elem : value) {
-        combine(elem);
-      }
-      return combine.seed;
-    }
+    return aoc::detail::hash_elements(value.data(), value.size());
   }
 };
 
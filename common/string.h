@@ -1,22 +1,32 @@
 #ifndef AOC_STRING_H
 #define AOC_STRING_H
 
+#include "assert.h"
+#include "bitmap_set.h"
 #include "compiler.h"
 #include "concepts.h"
 #include "flat.h"
+#include "hash.h"
 #include "parse.h"
 #include "range_to.h"
 #include "ranges.h"
+#include "scan.h"
+#include "static_vector.h"
 #include "utility.h"
 
 #ifndef AOC_MODULE_SUPPORT
 #ifndef AOC_IMPORT_STD
+#include <algorithm>
 #include <array>
 #include <concepts>
+#include <cstddef>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -83,6 +93,30 @@ constexpr std::string_view trim(std::string_view str,
   return str;
 }
 
+namespace detail {
+
+// all_whitespace is ' ' and '\t' through '\r',
+// two comparisons a character instead of a search through the set
+template <bool keep_spaces>
+constexpr bool is_trimmed_whitespace(char c) {
+  return (!keep_spaces && (c == ' ')) || ((c >= '\t') && (c <= '\r'));
+}
+static_assert(
+    std::ranges::all_of(all_whitespace, is_trimmed_whitespace<false>));
+
+template <bool keep_spaces>
+constexpr std::string_view trim_whitespace(std::string_view str) {
+  while (!str.empty() && is_trimmed_whitespace<keep_spaces>(str.front())) {
+    str.remove_prefix(1);
+  }
+  while (!str.empty() && is_trimmed_whitespace<keep_spaces>(str.back())) {
+    str.remove_suffix(1);
+  }
+  return str;
+}
+
+} // namespace detail
+
 template <class return_t = void, bool keep_spaces = false>
 struct trimmer_base {
   template <class R>
@@ -93,14 +127,8 @@ struct trimmer_base {
                            std::string, std::string_view>,
         return_t>;
     auto str = construct_string<std::string_view>(std::forward<R>(r));
-    constexpr std::string_view whitespace = [] {
-      if constexpr (keep_spaces) {
-        return all_whitespace.substr(1);
-      } else {
-        return all_whitespace;
-      }
-    }();
-    return construct_string<actual_ret_t>(trim(str, whitespace));
+    return construct_string<actual_ret_t>(
+        detail::trim_whitespace<keep_spaces>(str));
   }
 };
 template <class return_t = void>
@@ -152,47 +180,156 @@ constexpr auto read_lines_from_file(std::ifstream& file, Args...) {
   return std::views::istream<full_line<trimmer_t, keep_empty_lines>>(file);
 }
 
-} // namespace detail
+template <class... Args>
+class file_lines_view
+    : public std::ranges::view_interface<file_lines_view<Args...>> {
+ public:
+  file_lines_view(const std::string& filename, Args... args)
+      : m_file{std::make_unique<std::ifstream>(filename)},
+        m_lines{read_lines_from_file(*m_file, args...)} {}
 
-// https://stackoverflow.com/a/2602258
-std::string read_file(const std::string& filename) {
-  auto file = std::ifstream{filename};
-  auto buffer = std::stringstream{};
-  buffer << file.rdbuf();
-  return buffer.str();
-}
+  auto begin() { return std::ranges::begin(m_lines); }
+  auto end() { return std::ranges::end(m_lines); }
 
-namespace views {
+ private:
+  // On the heap, where moving the view does not move it from under m_lines
+  std::unique_ptr<std::ifstream> m_file;
+  decltype(read_lines_from_file(std::declval<std::ifstream&>(),
+                                std::declval<Args>()...)) m_lines;
+};
 
-struct __read_lines {
+template <bool keep_spaces, bool keep_empty_lines>
+class lines_view
+    : public std::ranges::view_interface<lines_view<keep_spaces,
+                                                    keep_empty_lines>> {
  public:
-  template <class... Args>
-  constexpr auto operator()(const std::string& filename, Args... args) {
-    m_file = std::ifstream{filename};
-    return detail::read_lines_from_file(m_file, std::forward<Args>(args)...);
-  }
-  template <class... Args>
-  constexpr auto operator()(std::ifstream& file, Args... args) const {
-    return detail::read_lines_from_file(file, std::forward<Args>(args)...);
-  }
+  class iterator {
+   public:
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+
+    constexpr iterator() = default;
+    constexpr explicit iterator(std::string_view text)
+        : m_text{text}, m_newlines{text, '\n'} {
+      advance();
+    }
+
+    constexpr std::string_view operator*() const { return m_line; }
+    constexpr iterator& operator++() {
+      advance();
+      return *this;
+    }
+    constexpr iterator operator++(int) {
+      auto previous = *this;
+      advance();
+      return previous;
+    }
+    constexpr bool operator==(const iterator& other) const {
+      return (m_done == other.m_done) && (m_next == other.m_next);
+    }
+    constexpr bool operator==(std::default_sentinel_t) const { return m_done; }
+
+   private:
+    // Same lines as getline would give, a last line without '\n' included
+    constexpr void advance() {
+      while (m_next < m_text.size()) {
+        auto end = m_text.size();
+        if (m_newlines != std::default_sentinel) {
+          end = *m_newlines;
+          ++m_newlines;
+        }
+        const auto line = m_text.substr(m_next, end - m_next);
+        m_next = std::ranges::min(end + 1, m_text.size());
+        if (keep_empty_lines || !line.empty()) {
+          m_line = trim_whitespace<keep_spaces>(line);
+          return;
+        }
+      }
+      m_done = true;
+    }
+
+    std::string_view m_text;
+    // The ends of all lines come out of one scan of the text
+    char_positions_view::iterator m_newlines;
+    std::size_t m_next = 0;
+    std::string_view m_line;
+    bool m_done = false;
+  };
+
+  constexpr lines_view() = default;
+  constexpr explicit lines_view(std::string_view text) : m_text{text} {}
+
+  constexpr iterator begin() const { return iterator{m_text}; }
+  constexpr std::default_sentinel_t end() const { return {}; }
 
  private:
-  std::ifstream m_file;
+  std::string_view m_text;
 };
 
-// MSVC does not emit a definition for an
-// exported non-constexpr `inline` variable from a module interface unit,
-// which makes `read_lines` an unresolved external in every consumer.
-// A constexpr callable wrapping a function-local static
-// gives the same single shared instance without relying on that.
-struct __read_lines_fn {
-  template <class... Args>
-  constexpr auto operator()(Args&&... args) const {
-    static __read_lines instance;
-    return instance(std::forward<Args>(args)...);
+} // namespace detail
+
+inline std::string read_file(const std::string& filename) {
+  auto file = std::ifstream{filename};
+  file.seekg(0, std::ios::end);
+  const auto size = static_cast<std::streamoff>(file.tellg());
+  if (size < 0) {
+    // Not seekable, read it as it comes
+    // https://stackoverflow.com/a/2602258
+    file.clear();
+    auto buffer = std::stringstream{};
+    buffer << file.rdbuf();
+    return buffer.str();
   }
-};
-constexpr inline __read_lines_fn read_lines{};
+  file.seekg(0, std::ios::beg);
+  auto contents = std::string(static_cast<std::size_t>(size), '\0');
+  file.read(contents.data(), size);
+  // Text mode on Windows reads "\r\n" as '\n', fewer characters than bytes
+  contents.resize(static_cast<std::size_t>(file.gcount()));
+  return contents;
+}
+
+namespace views {
+
+/**
+ * The lines of a string, as string_views into it.
+ *
+ * Trims and skips empty lines like read_lines,
+ * with the same keep_empty and keep_spaces tags,
+ * but allocates nothing.
+ * See mapped_file for reading the string straight from a file.
+ */
+template <class... Args>
+constexpr auto lines(std::string_view text, Args...) {
+  return detail::lines_view<contains_uncvref<keep_spaces, Args...>,
+                            contains_uncvref<keep_empty, Args...>>{text};
+}
+static_assert(std::ranges::equal(std::array{"a"sv, "b c"sv},
+                                 lines(" a \n\nb c\r\n\n")));
+static_assert(std::ranges::equal(std::array{"a"sv, ""sv, "b"sv},
+                                 lines("a\n\nb", keep_empty{})));
+static_assert(std::ranges::equal(std::array{" a"sv}, lines(" a\r\n",
+                                                          keep_spaces{})));
+
+} // namespace views
+
+namespace views {
+
+/**
+ * The lines of a file, trimmed and without the empty ones
+ * unless told otherwise with keep_spaces and keep_empty.
+ *
+ * The view owns the stream it reads from,
+ * every call has its own, so files can be read in parallel or nested.
+ */
+template <class... Args>
+auto read_lines(const std::string& filename, Args... args) {
+  return detail::file_lines_view<Args...>{filename, args...};
+}
+/// Reads the lines off a stream the caller keeps open
+template <class... Args>
+constexpr auto read_lines(std::ifstream& file, Args... args) {
+  return detail::read_lines_from_file(file, args...);
+}
 
 template <class T, class... Args>
 constexpr auto read_numbers(const std::string& filename, Args... args) {
@@ -371,25 +508,20 @@ constexpr auto split(R&& r, Pattern&& delimiter, Proj proj = {}) {
     }
   }();
   using value_type = typename decltype(out)::value_type;
-  auto split_view = [&]() {
-    if constexpr (std::same_as<std::decay_t<Pattern>, const char*>) {
-      return r | std::views::split(std::string_view{delimiter});
-    } else {
-      return r | std::views::split(delimiter);
-    }
-  }();
   constexpr const auto fixed_capacity = static_size<decltype(out)>();
 
   int count = 0;
-  for (auto out_it = inserter_it(out); auto&& v : split_view) {
+  auto out_it = inserter_it(out);
+  // False once the output is full
+  const auto store = [&](auto&& v) {
     if constexpr (skip_empty) {
       if (std::ranges::empty(v)) {
-        continue;
+        return true;
       }
     }
     if constexpr (fixed_capacity != std::string::npos) {
       if (count >= fixed_capacity) {
-        break;
+        return false;
       }
     }
     *out_it = construct<value_type>(proj(v));
@@ -397,9 +529,45 @@ constexpr auto split(R&& r, Pattern&& delimiter, Proj proj = {}) {
     if constexpr (fixed_capacity != std::string::npos) {
       ++count;
     }
+    return true;
+  };
+
+  if constexpr (std::ranges::contiguous_range<R> &&
+                std::same_as<std::ranges::range_value_t<R>, char> &&
+                std::same_as<std::remove_cvref_t<Pattern>, char>) {
+    // The usual case of a line split on one character,
+    // all its delimiters come out of one scan instead of a find each
+    const auto str = construct_string<std::string_view>(r);
+    if (str.empty()) {
+      return out;
+    }
+    std::size_t start = 0;
+    for (const std::size_t pos : views::char_positions(str, delimiter)) {
+      if (!store(str.substr(start, pos - start))) {
+        return out;
+      }
+      start = pos + 1;
+    }
+    store(str.substr(start));
+  } else {
+    auto split_view = [&]() {
+      if constexpr (std::same_as<std::decay_t<Pattern>, const char*>) {
+        return r | std::views::split(std::string_view{delimiter});
+      } else {
+        return r | std::views::split(delimiter);
+      }
+    }();
+    for (auto&& v : split_view) {
+      if (!store(v)) {
+        break;
+      }
+    }
   }
   return out;
 }
+static_assert(std::ranges::equal(std::array{"a"sv, ""sv, "bc"sv, ""sv},
+                                 split("a,,bc,"sv, ',')));
+static_assert(split(""sv, ',').empty());
 static_assert(std::ranges::equal(
     std::array{"adsf", "qwret", "nvfkbdsj", "orthdfjgh", "dfjrleih"},
     split<std::array<std::string_view, 5>, true>(
@@ -474,6 +642,54 @@ constexpr auto split_once(std::string_view str, Pattern&& delimiter,
 static_assert("world today" == split_once("hello world today", ' ')[1]);
 static_assert(2 == aoc::split_once<int>("1 2", ' ')[1]);
 
+/**
+ * parse_all_integers into a container, see parse.h.
+ *
+ * An integral type collects into a std::vector of it,
+ * anything else is the container to fill.
+ * Fixed size and fixed capacity ones (std::array, static_vector)
+ * are filled until full, what does not fit is ignored.
+ *
+ * @code
+ * auto all = aoc::parse_all_integers("Sensor at x=2, y=-18: ...");
+ * static_assert(std::same_as<decltype(all), std::vector<int>>);
+ * let [x, y, z] = aoc::parse_all_integers<std::array<i64, 3>>("1,-2,3");
+ * @endcode
+ */
+template <class output_t = int>
+constexpr auto parse_all_integers(std::string_view text) {
+  if constexpr (std::integral<output_t>) {
+    return parse_all_integers<std::vector<output_t>>(text);
+  } else {
+    using value_type = typename output_t::value_type;
+    auto out = output_t{};
+    if constexpr (is_array_class_v<output_t>) {
+      parse_all_integers(text, std::span<value_type>{out});
+    } else {
+      // Stops at max_size(): the capacity of a static_vector,
+      // effectively unbounded for a Vec
+      auto scanner = integer_scanner<value_type>{text};
+      for (value_type value{};
+           (out.size() < out.max_size()) && scanner.next(value);) {
+        out.push_back(value);
+      }
+    }
+    return out;
+  }
+}
+static_assert(std::ranges::equal(
+    std::array{2, -18, -2, 15},
+    parse_all_integers("Sensor at x=2, y=-18: closest beacon is at x=-2, "
+                       "y=15")));
+static_assert(std::array{12, -345} ==
+              parse_all_integers<std::array<int, 2>>("12-345-6789"));
+static_assert(std::ranges::equal(std::array{3u, 3u},
+                                 parse_all_integers<unsigned>("v=3,-3")));
+static_assert(std::ranges::equal(
+    std::array{1, -2, 3}, parse_all_integers<static_vector<int, 4>>("1,-2,3")));
+static_assert(std::ranges::equal(
+    std::array{1, -2}, parse_all_integers<static_vector<int, 2>>("1,-2,3")));
+
 /**
  * split_sstream takes a slightly different approach to splitting a string
  * than `split`, by not specifying a delimiter, but the delimiter is determined
@@ -580,46 +796,232 @@ static_assert(2 == count_substrings("abcyabc", "abc"));
 static_assert(2 == count_substrings("abcyacabc", "abc"));
 static_assert(2 == count_substrings("cbacba" | std::views::reverse, "abc"));
 
+namespace detail {
+
+/**
+ * Keeps copies of strings, packed one after the other in large blocks.
+ *
+ * A block is never reallocated,
+ * so the views handed out stay valid as long as the arena, moved or not.
+ */
+class string_arena {
+ public:
+  string_arena() = default;
+  string_arena(const string_arena&) = delete;
+  string_arena& operator=(const string_arena&) = delete;
+  // The moved from arena must not keep writing into the moved blocks
+  string_arena(string_arena&& other) noexcept
+      : m_blocks{std::move(other.m_blocks)},
+        m_next{std::exchange(other.m_next, nullptr)},
+        m_remaining{std::exchange(other.m_remaining, 0)} {}
+  string_arena& operator=(string_arena&& other) noexcept {
+    m_blocks = std::move(other.m_blocks);
+    m_next = std::exchange(other.m_next, nullptr);
+    m_remaining = std::exchange(other.m_remaining, 0);
+    return *this;
+  }
+
+  std::string_view store(std::string_view str) {
+    if (str.size() > m_remaining) {
+      const auto size = std::ranges::max(block_size, str.size());
+      m_blocks.push_back(std::make_unique_for_overwrite<char[]>(size));
+      m_next = m_blocks.back().get();
+      m_remaining = size;
+    }
+    std::ranges::copy(str, m_next);
+    const auto stored = std::string_view{m_next, str.size()};
+    m_next += str.size();
+    m_remaining -= str.size();
+    return stored;
+  }
+
+ private:
+  static constexpr std::size_t block_size = 4096;
+
+  std::vector<std::unique_ptr<char[]>> m_blocks;
+  char* m_next = nullptr;
+  std::size_t m_remaining = 0;
+};
+
+} // namespace detail
+
+/**
+ * Gives every distinct name an id, counting up in the order they come in.
+ *
+ * Each name is copied once into an arena and found again by its hash,
+ * there is no allocation per name and no sorted vector to shift.
+ * See fixed_name_to_id for names of a known width.
+ */
 class name_to_id {
  public:
-  constexpr name_to_id() = default;
+  name_to_id() = default;
 
-  constexpr explicit name_to_id(std::size_t start) : current_id(start) {}
+  explicit name_to_id(std::size_t start) : m_start(start) {}
 
-  constexpr std::size_t intern(std::string_view name) {
-    const auto it = name_ids.find(name);
-    if (it != std::end(name_ids)) {
+  // The ids are keyed on views into the arena, a copy needs its own
+  name_to_id(const name_to_id& other) : name_to_id(other.m_start) {
+    m_names.reserve(other.m_names.size());
+    m_ids.reserve(other.m_names.size());
+    for (const auto name : other.m_names) {
+      intern(name);
+    }
+  }
+  name_to_id& operator=(const name_to_id& other) {
+    auto copy = other;
+    return *this = std::move(copy);
+  }
+  name_to_id(name_to_id&&) = default;
+  name_to_id& operator=(name_to_id&&) = default;
+
+  std::size_t intern(std::string_view name) {
+    if (const auto it = m_ids.find(name); it != std::end(m_ids)) {
       return it->second;
     }
-    name_ids.emplace(std::string{name}, current_id);
-    return current_id++;
+    const auto id = m_start + m_names.size();
+    const auto stored = m_arena.store(name);
+    m_names.push_back(stored);
+    m_ids.emplace(stored, id);
+    return id;
   }
 
-  constexpr std::optional<std::size_t> get(std::string_view name) const {
-    const auto it = name_ids.find(name);
-    if (it != std::end(name_ids)) {
+  std::optional<std::size_t> get(std::string_view name) const {
+    const auto it = m_ids.find(name);
+    if (it != std::end(m_ids)) {
       return it->second;
     }
     return {};
   }
 
-  constexpr std::size_t expect(std::string_view name) const {
-    const auto it = name_ids.find(name);
-    if (it != std::end(name_ids)) {
+  std::size_t expect(std::string_view name) const {
+    const auto it = m_ids.find(name);
+    if (it != std::end(m_ids)) {
       return it->second;
     }
     throw std::runtime_error(std::format("name '{}' not found", name));
   }
 
+  /// The name an id was given to
+  std::string_view name(std::size_t id) const {
+    AOC_ASSERT((id >= m_start) && (id - m_start < m_names.size()),
+               "Id was never given out");
+    return m_names[id - m_start];
+  }
+
+  std::size_t new_size(std::size_t old_size) const {
+    return std::ranges::max(m_start + m_names.size(), old_size);
+  }
+
+  // Snapshotted by AOC_CACHED_PARSE as its names, see parse_cache.h
+  std::pair<std::size_t, std::vector<std::string>> aoc_to_snapshot() const {
+    return {m_start, m_names | ranges::to<std::vector<std::string>>()};
+  }
+  static name_to_id aoc_from_snapshot(
+      const std::pair<std::size_t, std::vector<std::string>>& snapshot) {
+    auto result = name_to_id{snapshot.first};
+    for (const auto& name : snapshot.second) {
+      result.intern(name);
+    }
+    return result;
+  }
+
+ private:
+  std::size_t m_start{0};
+  detail::string_arena m_arena;
+  // By id, counted from m_start
+  std::vector<std::string_view> m_names;
+  hash_map<std::string_view, std::size_t> m_ids;
+};
+
+/**
+ * name_to_id for names of exactly `width` characters in [first, last],
+ * like the two lowercase letters of 2024/day23.
+ *
+ * The id is the name read as a number, one digit per character,
+ * so finding it needs no hashing and no storage,
+ * and ids sort the same as their names.
+ * They are not dense though, they span every possible name.
+ */
+template <std::size_t width, char first = 'a', char last = 'z'>
+  requires(width > 0) && (first <= last)
+class fixed_name_to_id {
+ public:
+  static constexpr std::size_t radix =
+      static_cast<std::size_t>(last - first) + 1;
+  static constexpr std::size_t capacity = [] {
+    std::size_t result = 1;
+    for (std::size_t i = 0; i < width; ++i) {
+      result *= radix;
+    }
+    return result;
+  }();
+
+  static constexpr bool is_name(std::string_view name) {
+    return (name.size() == width) && std::ranges::all_of(name, [](char c) {
+             return (c >= first) && (c <= last);
+           });
+  }
+
+  /// The id of a name, whether it was interned or not
+  static constexpr std::size_t id_of(std::string_view name) {
+    AOC_ASSERT(is_name(name), "Name does not have the fixed width and range");
+    std::size_t id = 0;
+    for (const char c : name) {
+      id = id * radix + static_cast<std::size_t>(c - first);
+    }
+    return id;
+  }
+
+  static constexpr std::string name(std::size_t id) {
+    auto result = std::string(width, first);
+    for (auto& c : result | std::views::reverse) {
+      c = static_cast<char>(first + static_cast<char>(id % radix));
+      id /= radix;
+    }
+    return result;
+  }
+
+  constexpr std::size_t intern(std::string_view name) {
+    const auto id = id_of(name);
+    m_interned.insert(id);
+    m_end = std::ranges::max(m_end, id + 1);
+    return id;
+  }
+
+  constexpr std::optional<std::size_t> get(std::string_view name) const {
+    if (!is_name(name) || !m_interned.contains(id_of(name))) {
+      return {};
+    }
+    return id_of(name);
+  }
+
+  constexpr std::size_t expect(std::string_view name) const {
+    if (const auto id = get(name)) {
+      return *id;
+    }
+    throw std::runtime_error(std::format("name '{}' not found", name));
+  }
+
+  /// Past the largest id interned, not the number of names
   constexpr std::size_t new_size(std::size_t old_size) const {
-    return std::ranges::max(current_id, old_size);
+    return std::ranges::max(m_end, old_size);
   }
 
  private:
-  std::size_t current_id{0};
-  flat_map<std::string, std::size_t> name_ids{};
+  bitmap_set<std::size_t, capacity> m_interned;
+  std::size_t m_end = 0;
 };
 
+static_assert(fixed_name_to_id<2>::capacity == 26 * 26);
+static_assert(fixed_name_to_id<2>::id_of("ab") == 1);
+static_assert(fixed_name_to_id<2>::id_of("ba") == 26);
+static_assert(fixed_name_to_id<2>::name(26 * 26 - 1) == "zz");
+static_assert([] {
+  auto ids = fixed_name_to_id<2>{};
+  ids.intern("tc");
+  return ids.get("tc").has_value() && !ids.get("ct").has_value() &&
+         !ids.get("tcc").has_value() && (ids.new_size(0) == 19 * 26 + 3);
+}());
+
 namespace ranges {
 
 template <std::ranges::viewable_range R>
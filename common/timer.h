@@ -8,46 +8,56 @@
 #ifndef AOC_MODULE_SUPPORT
 #ifndef AOC_IMPORT_STD
 #include <chrono>
+#include <cstdint>
 #include <print>
+#include <string_view>
 #endif
 #endif
 
 AOC_EXPORT_NAMESPACE(aoc) {
 
+/**
+ * Measures elapsed wall time on the steady clock.
+ *
+ * system_clock follows NTP and can be stepped backwards or forwards
+ * in the middle of a measurement, steady_clock never is.
+ * Everything is kept at the clock's own resolution,
+ * truncating to whole milliseconds made most solves read as 0 ms.
+ */
 class timer {
  public:
+  using clock = std::chrono::steady_clock;
+
   void start() {
-    start_time_ = std::chrono::system_clock::now();
+    start_time_ = clock::now();
     running_ = true;
   }
 
   void stop() {
-    end_time_ = std::chrono::system_clock::now();
+    end_time_ = clock::now();
     running_ = false;
   }
 
-  double milliseconds() {
-    std::chrono::time_point<std::chrono::system_clock> end_time;
-
-    if (running_) {
-      end_time = std::chrono::system_clock::now();
-    } else {
-      end_time = end_time_;
-    }
-
-    return (double)std::chrono::duration_cast<std::chrono::milliseconds>(
-               end_time - start_time_)
+  std::int64_t nanoseconds() const {
+    const auto end_time = running_ ? clock::now() : end_time_;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end_time -
+                                                                start_time_)
         .count();
   }
 
-  double seconds() { return milliseconds() / 1000.0; }
+  double milliseconds() const {
+    return static_cast<double>(this->nanoseconds()) / 1'000'000.0;
+  }
+
+  double seconds() const { return milliseconds() / 1000.0; }
 
  private:
-  std::chrono::time_point<std::chrono::system_clock> start_time_;
-  std::chrono::time_point<std::chrono::system_clock> end_time_;
+  clock::time_point start_time_;
+  clock::time_point end_time_;
   bool running_ = false;
 };
 
+// See scoped_counters in perf_counters.h for the hardware counters as well
 class scoped_timer {
  public:
   scoped_timer(std::string_view msg = "") {
@@ -59,7 +69,7 @@ class scoped_timer {
 
   ~scoped_timer() {
     timer_.stop();
-    std::println("{} ms", timer_.milliseconds());
+    std::println("{:.3f} ms", timer_.milliseconds());
   }
 
  private:
@@ -0,0 +1,219 @@
+#ifndef AOC_TRACE_H
+#define AOC_TRACE_H
+
+// Timeline tracing, opt in with AOC_TRACE.
+//
+// Every trace_scope becomes one slice on its thread's track
+// of a Chrome trace, written when the process exits
+// to AOC_TRACE_FILE, trace.json in the working directory without it.
+// Load it in Perfetto (ui.perfetto.dev) or chrome://tracing
+// to see how the work of the threaded days spreads over their threads.
+//
+// Not part of the module: the buffers are per process and per thread,
+// and it is only ever included from common.h, after harness.h.
+//
+// Without AOC_TRACE trace_scope is empty
+// and AOC_TRACE_SCOPE only passes its arguments to a temporary one.
+// They are evaluated and then optimized away, so a lambda capture
+// only the trace reads still counts as used (-Wunused-lambda-capture).
+//
+// aoc_runner -j ends its forked days with _Exit, which writes nothing,
+// trace the runner without -j.
+
+#include "compiler.h"
+
+#ifndef AOC_IMPORT_STD
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <print>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#endif
+
+namespace aoc {
+
+#ifdef AOC_TRACE
+
+inline constexpr bool tracing = true;
+
+namespace detail {
+
+struct trace_event {
+  // A string literal, written as is
+  const char* name;
+  std::int64_t index;
+  std::int64_t begin_ns;
+  std::int64_t end_ns;
+};
+
+// Only ever appended to by its own thread, the recorder reads it at exit
+struct trace_buffer {
+  std::size_t thread_number;
+  bool main_thread;
+  std::vector<trace_event> events;
+};
+
+inline std::int64_t trace_clock_ns() {
+  static const auto origin = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - origin)
+      .count();
+}
+
+// Initialized before main, so by the main thread
+inline const std::thread::id g_trace_main_thread = std::this_thread::get_id();
+
+// Resolved before main, the runner changes directories between days
+inline const std::string g_trace_file = [] {
+  auto path = std::filesystem::path{
+      harness::environment_variable("AOC_TRACE_FILE").value_or("trace.json")};
+  auto error = std::error_code{};
+  const auto absolute = std::filesystem::absolute(path, error);
+  // Starts the clock as well
+  trace_clock_ns();
+  return (error ? path : absolute).string();
+}();
+
+class trace_recorder {
+ public:
+  trace_recorder() = default;
+  trace_recorder(const trace_recorder&) = delete;
+  trace_recorder& operator=(const trace_recorder&) = delete;
+
+  // The threads are all joined by now
+  ~trace_recorder() { write(g_trace_file); }
+
+  /// The only point that locks, once per thread
+  trace_buffer& register_thread() {
+    const auto lock = std::scoped_lock{m_mutex};
+    auto& buffer = *m_buffers.emplace_back(std::make_unique<trace_buffer>(
+        trace_buffer{.thread_number = m_buffers.size() + 1,
+                     .main_thread =
+                         (std::this_thread::get_id() == g_trace_main_thread),
+                     .events = {}}));
+    // Keeps the first few thousand slices from reallocating mid-measurement
+    buffer.events.reserve(4096);
+    return buffer;
+  }
+
+  void write(const std::string& path) {
+    const auto lock = std::scoped_lock{m_mutex};
+    auto file = std::ofstream{path};
+    if (!file) {
+      std::println("Cannot write the trace to {}", path);
+      return;
+    }
+    // ts and dur are in microseconds
+    std::print(file, "{{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    const char* separator = "\n";
+    for (const auto& buffer : m_buffers) {
+      std::print(file,
+                 "{}{{\"ph\":\"M\",\"pid\":1,\"tid\":{},\"name\":"
+                 "\"thread_name\",\"args\":{{\"name\":\"{}\"}}}}",
+                 separator, buffer->thread_number,
+                 buffer->main_thread
+                     ? std::string{"main"}
+                     : std::format("thread {}", buffer->thread_number));
+      separator = ",\n";
+      for (const auto& event : buffer->events) {
+        std::print(file,
+                   "{}{{\"ph\":\"X\",\"pid\":1,\"tid\":{},\"name\":\"{}\","
+                   "\"ts\":{:.3f},\"dur\":{:.3f}",
+                   separator, buffer->thread_number, event.name,
+                   static_cast<double>(event.begin_ns) / 1000.0,
+                   static_cast<double>(event.end_ns - event.begin_ns) /
+                       1000.0);
+        if (event.index >= 0) {
+          std::print(file, ",\"args\":{{\"index\":{}}}", event.index);
+        }
+        std::print(file, "}}");
+      }
+    }
+    std::println(file, "\n]}}");
+  }
+
+ private:
+  std::mutex m_mutex;
+  // Stable addresses, the threads hold on to their buffer
+  std::vector<std::unique_ptr<trace_buffer>> m_buffers;
+};
+
+inline trace_recorder& get_trace_recorder() {
+  static auto recorder = trace_recorder{};
+  return recorder;
+}
+
+inline trace_buffer& this_thread_trace_buffer() {
+  thread_local trace_buffer& buffer = get_trace_recorder().register_thread();
+  return buffer;
+}
+
+} // namespace detail
+
+/**
+ * Records the time from construction to destruction as one slice
+ * on the calling thread's track.
+ *
+ * The name has to be a string literal, only the pointer is kept.
+ * The index shows up as an argument of the slice,
+ * to tell apart the chunks of one loop.
+ *
+ * Usable inside constexpr functions, it records nothing at compile time.
+ */
+class trace_scope {
+ public:
+  constexpr explicit trace_scope(const char* name, std::int64_t index = -1)
+      : m_name{name}, m_index{index} {
+    if (!std::is_constant_evaluated()) {
+      m_begin_ns = detail::trace_clock_ns();
+    }
+  }
+  trace_scope(const trace_scope&) = delete;
+  trace_scope& operator=(const trace_scope&) = delete;
+
+  constexpr ~trace_scope() {
+    if (!std::is_constant_evaluated()) {
+      const auto end_ns = detail::trace_clock_ns();
+      detail::this_thread_trace_buffer().events.push_back(
+          {m_name, m_index, m_begin_ns, end_ns});
+    }
+  }
+
+ private:
+  const char* m_name;
+  std::int64_t m_index;
+  std::int64_t m_begin_ns = 0;
+};
+
+#define AOC_TRACE_CONCAT_IMPL(a, b) a##b
+#define AOC_TRACE_CONCAT(a, b) AOC_TRACE_CONCAT_IMPL(a, b)
+/// Traces the rest of the enclosing block
+#define AOC_TRACE_SCOPE(...)                                                   \
+  const aoc::trace_scope AOC_TRACE_CONCAT(aoc_trace_scope_, __LINE__) {        \
+    __VA_ARGS__                                                                \
+  }
+
+#else
+
+inline constexpr bool tracing = false;
+
+class trace_scope {
+ public:
+  constexpr explicit trace_scope(const char*, std::int64_t = -1) noexcept {}
+};
+
+#define AOC_TRACE_SCOPE(...) static_cast<void>(aoc::trace_scope{__VA_ARGS__})
+
+#endif // AOC_TRACE
+
+} // namespace aoc
+
+#endif // AOC_TRACE_H
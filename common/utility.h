@@ -39,8 +39,18 @@ AOC_EXPORT_NAMESPACE(aoc) {
 #endif
 #endif
 
+/// Caps num_worker_threads when non-zero,
+/// the runner hands every day it runs side by side its share of the machine
+inline unsigned& worker_thread_budget() {
+  static unsigned budget = 0;
+  return budget;
+}
+
 inline unsigned num_worker_threads() {
-  const auto available = std::max(1u, std::thread::hardware_concurrency());
+  auto available = std::max(1u, std::thread::hardware_concurrency());
+  if (const auto budget = worker_thread_budget(); budget > 0) {
+    available = std::min(available, budget);
+  }
 #ifdef AOC_DEBUG_THREAD_CAP
   return std::min(available, unsigned{AOC_DEBUG_THREAD_CAP});
 #else
@@ -75,11 +85,23 @@ constexpr auto insertion_end_it(output_t& elems) {
 
 /// Custom flush function so that users of the aoc module
 /// don't have to include iostream
-void flush() { std::cout << std::flush; }
+inline void flush() { std::cout << std::flush; }
+
+/// Thrown by return_incomplete when the test shares its process with others
+struct incomplete_test {};
 
-void return_incomplete() {
+/// Whether return_incomplete ends the process, the runner turns this off
+inline bool& exit_on_incomplete() {
+  static bool exit = true;
+  return exit;
+}
+
+inline void return_incomplete() {
   std::println("  This test is incomplete, skipping");
   flush();
+  if (!exit_on_incomplete()) {
+    throw incomplete_test{};
+  }
   std::exit(AOC_SKIP_RETURN_CODE);
 }
 
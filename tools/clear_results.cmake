@@ -0,0 +1,6 @@
+# Removes the records a previous test run left in AOC_RESULTS_DIR.
+# Only the records, the directory may well hold other things.
+file(GLOB old_records "${AOC_RESULTS_DIR}/*.jsonl")
+if (old_records)
+  file(REMOVE ${old_records})
+endif()
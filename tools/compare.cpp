@@ -0,0 +1,210 @@
+// Runs the C++ and the Rust solution of the same days on the same inputs
+// and lays their times and memory side by side,
+// to show which of the two falls behind where.
+//
+// Usage: aoc_compare [--repetitions=N] [--warmup=N] <days file>
+//                    [year | year/day]...
+//
+// The days file is written by CMake, see tools/CMakeLists.txt.
+// One day per line: name, then executable and working directory
+// of the C++ solution and then of the Rust one, separated by tabs.
+// Without a selection every day in it runs.
+//
+// Both are timed as whole processes, startup included,
+// so neither gets credit for what the other does before main.
+// Each run is checked once first, a failing day is not timed.
+// Repetitions default to AOC_BENCH_REPETITIONS, or 5 without it.
+//
+// POSIX only, it forks and execs the solutions.
+
+#include "../common/common.h"
+#include "process.h"
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#endif
+
+namespace {
+
+using aoc::tools::outcome;
+using aoc::tools::program;
+
+struct compared_day {
+  std::string name;
+  program cpp;
+  program rust;
+};
+
+std::vector<compared_day> load_days(const std::string& path) {
+  auto days = std::vector<compared_day>{};
+  auto file = std::ifstream{path};
+  for (auto line = std::string{}; std::getline(file, line);) {
+    const auto fields = aoc::split_to_vec<std::string>(line, "\t");
+    if (fields.size() != 5) {
+      continue;
+    }
+    days.push_back({
+        .name = fields[0],
+        .cpp = {fields[1], fields[2]},
+        .rust = {fields[3], fields[4]},
+    });
+  }
+  return days;
+}
+
+// 2023_day01 is selected by 2023 and by 2023/day01
+bool is_selected(std::string_view name,
+                 std::span<const std::string_view> selection) {
+  if (selection.empty()) {
+    return true;
+  }
+  return std::ranges::any_of(selection, [&](std::string_view selector) {
+    const auto year = name.substr(0, name.find('_'));
+    auto slashed = std::string{name};
+    std::ranges::replace(slashed, '_', '/');
+    return (selector == year) || (selector == slashed);
+  });
+}
+
+struct measurement {
+  outcome result = outcome::failed;
+  aoc::benchmark_stats stats;
+  std::uint64_t peak_rss_kb = 0;
+};
+
+measurement measure(const program& prog,
+                    const aoc::benchmark_config& config) {
+  aoc::flush();
+  const auto check = aoc::tools::run_process(prog);
+  if (check.result != outcome::passed) {
+    return {.result = check.result, .stats = {}, .peak_rss_kb = 0};
+  }
+  auto peak_rss_kb = check.peak_rss_kb;
+  auto result = outcome::passed;
+  const auto [_, stats] = aoc::benchmark(
+      [&] {
+        const auto run = aoc::tools::run_process(prog);
+        peak_rss_kb = std::max(peak_rss_kb, run.peak_rss_kb);
+        if (run.result != outcome::passed) {
+          result = outcome::failed;
+        }
+        return run.result;
+      },
+      config);
+  return {.result = result, .stats = stats, .peak_rss_kb = peak_rss_kb};
+}
+
+std::string format_time(const measurement& run) {
+  switch (run.result) {
+    case outcome::passed:
+      return std::format("{:.3f}", static_cast<double>(run.stats.median_ns) /
+                                       1'000'000.0);
+    case outcome::failed:
+      return "FAIL";
+    case outcome::skipped:
+      return "SKIP";
+    case outcome::timed_out:
+      return "TIMEOUT";
+  }
+  AOC_UNREACHABLE("Unknown outcome");
+}
+
+std::string format_memory(const measurement& run) {
+  if (run.result != outcome::passed) {
+    return "-";
+  }
+  return std::format("{:.1f}", static_cast<double>(run.peak_rss_kb) / 1024.0);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  auto config = aoc::benchmark_config{};
+  if (const auto& options = aoc::harness::get_options();
+      options.benchmarking()) {
+    config.repetitions = options.bench_repetitions;
+    config.warmup = options.bench_warmup;
+  } else {
+    config.repetitions = 5;
+  }
+
+  auto days_path = std::string{};
+  auto selection = std::vector<std::string_view>{};
+  for (const auto argument : std::span{argv + 1, argv + argc}) {
+    const auto arg = std::string_view{argument};
+    const auto value_of = [&](std::string_view option) {
+      return aoc::to_number<int>(arg.substr(option.size()));
+    };
+    if (arg.starts_with("--repetitions=")) {
+      config.repetitions = std::max(value_of("--repetitions="), 1);
+    } else if (arg.starts_with("--warmup=")) {
+      config.warmup = std::max(value_of("--warmup="), 0);
+    } else if (days_path.empty()) {
+      days_path = arg;
+    } else {
+      selection.push_back(arg);
+    }
+  }
+  if (days_path.empty()) {
+    std::println("Usage: {} [--repetitions=N] [--warmup=N] <days file> "
+                 "[year | year/day]...",
+                 argv[0]);
+    return 1;
+  }
+
+  auto days = load_days(days_path);
+  std::erase_if(days, [&](const compared_day& day) {
+    return !is_selected(day.name, selection);
+  });
+  if (days.empty()) {
+    std::println("Nothing to compare in {}", days_path);
+    return 1;
+  }
+
+  std::println("Median of {} runs after {} warmup, whole processes",
+               config.repetitions, config.warmup);
+  std::println("  {:<12} {:>12} {:>12} {:>9} {:>10} {:>10}", "day", "C++ ms",
+               "Rust ms", "gap", "C++ MiB", "Rust MiB");
+  bool any_failed = false;
+  // Summed in log space, the mean of ratios has to be a geometric one
+  double log_ratio_sum = 0;
+  int num_ratios = 0;
+  for (const auto& day : days) {
+    const auto cpp = measure(day.cpp, config);
+    const auto rust = measure(day.rust, config);
+    any_failed = any_failed || (cpp.result == outcome::failed) ||
+                 (rust.result == outcome::failed);
+
+    // Positive when the C++ solution is the slower one
+    auto gap = std::string{"-"};
+    if ((cpp.result == outcome::passed) && (rust.result == outcome::passed) &&
+        (rust.stats.median_ns > 0)) {
+      const auto ratio = static_cast<double>(cpp.stats.median_ns) /
+                         static_cast<double>(rust.stats.median_ns);
+      gap = std::format("{:+.1f}%", (ratio - 1.0) * 100.0);
+      log_ratio_sum += std::log(ratio);
+      ++num_ratios;
+    }
+    auto name = day.name;
+    std::ranges::replace(name, '_', '/');
+    std::println("  {:<12} {:>12} {:>12} {:>9} {:>10} {:>10}", name,
+                 format_time(cpp), format_time(rust), gap, format_memory(cpp),
+                 format_memory(rust));
+    aoc::flush();
+  }
+  if (num_ratios > 0) {
+    std::println("C++ against Rust over {} days: {:+.1f}% (geometric mean)",
+                 num_ratios,
+                 (std::exp(log_ratio_sum / num_ratios) - 1.0) * 100.0);
+  }
+  return any_failed ? 1 : 0;
+}
@@ -0,0 +1,124 @@
+#ifndef AOC_TOOLS_PROCESS_H
+#define AOC_TOOLS_PROCESS_H
+
+// Runs a test executable as a child process and measures it from outside,
+// for the tools comparing whole runs rather than single checks.
+//
+// POSIX only, it forks and execs.
+
+#include "../common/compiler.h"
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#ifndef AOC_IMPORT_STD
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+#endif
+
+namespace aoc::tools {
+
+struct program {
+  std::string executable;
+  std::string working_dir;
+};
+
+enum class outcome { passed, failed, skipped, timed_out };
+
+struct process_limits {
+  // Wall time, whole seconds, 0 for none
+  unsigned seconds = 0;
+  // Address space, 0 for none
+  std::uint64_t memory_mib = 0;
+};
+
+struct process_run {
+  outcome result = outcome::failed;
+  std::uint64_t peak_rss_kb = 0;
+};
+
+/**
+ * Runs the program to completion with its output thrown away.
+ *
+ * The harness variables are cleared for it before the given ones are set,
+ * a test repeating its checks internally or writing records
+ * would not be measuring what the caller thinks it is.
+ */
+inline process_run run_process(
+    const program& prog,
+    std::span<const std::pair<const char*, std::string>> environment = {},
+    const process_limits& limits = {}) {
+  // Anything still buffered would be written twice, once by each process
+  std::fflush(nullptr);
+  const pid_t pid = ::fork();
+  if (pid < 0) {
+    throw std::system_error{errno, std::generic_category(), "fork"};
+  }
+  if (pid == 0) {
+    if (::chdir(prog.working_dir.c_str()) != 0) {
+      std::_Exit(127);
+    }
+    if (const int null_fd = ::open("/dev/null", O_WRONLY); null_fd >= 0) {
+      ::dup2(null_fd, STDOUT_FILENO);
+      ::dup2(null_fd, STDERR_FILENO);
+      ::close(null_fd);
+    }
+    for (const char* variable :
+         {"AOC_BENCH_REPETITIONS", "AOC_BENCH_WARMUP", "AOC_RESULTS_FILE",
+          "AOC_REPORT_MEMORY", "AOC_TRACE_FILE", "AOC_SCALED_INPUT",
+          "AOC_PARSE_CACHE"}) {
+      ::unsetenv(variable);
+    }
+    for (const auto& [name, value] : environment) {
+      ::setenv(name, value.c_str(), 1);
+    }
+    if (limits.memory_mib > 0) {
+      const auto bytes = static_cast<rlim_t>(limits.memory_mib) * 1024 * 1024;
+      const auto memory = rlimit{.rlim_cur = bytes, .rlim_max = bytes};
+      ::setrlimit(RLIMIT_AS, &memory);
+    }
+    // Survives the exec, and kills the program once it runs out
+    ::alarm(limits.seconds);
+    ::execl(prog.executable.c_str(), prog.executable.c_str(), nullptr);
+    std::_Exit(127);
+  }
+
+  int status = 0;
+  auto usage = rusage{};
+  while (::wait4(pid, &status, 0, &usage) < 0) {
+    if (errno != EINTR) {
+      return {};
+    }
+  }
+  auto run = process_run{};
+#ifdef __APPLE__
+  // Bytes on macOS, KiB everywhere else
+  run.peak_rss_kb = static_cast<std::uint64_t>(usage.ru_maxrss) / 1024;
+#else
+  run.peak_rss_kb = static_cast<std::uint64_t>(usage.ru_maxrss);
+#endif
+  if (WIFEXITED(status)) {
+    if (WEXITSTATUS(status) == 0) {
+      run.result = outcome::passed;
+    } else if (WEXITSTATUS(status) == AOC_SKIP_RETURN_CODE) {
+      run.result = outcome::skipped;
+    }
+  } else if (WIFSIGNALED(status) && (WTERMSIG(status) == SIGALRM)) {
+    run.result = outcome::timed_out;
+  }
+  return run;
+}
+
+} // namespace aoc::tools
+
+#endif // AOC_TOOLS_PROCESS_H
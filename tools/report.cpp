@@ -0,0 +1,259 @@
+// Merges the per-check records written by the tests into a single report.
+// See common/harness.h for the records themselves.
+//
+// Usage: aoc_report <report.json | report.csv> <file or directory>...
+//
+// Directories are searched for *.jsonl files.
+// Files are merged in sorted order,
+// so the reports of two runs line up when diffed.
+
+#include "../common/common.h"
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <print>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#endif
+
+namespace {
+
+using record_t = std::map<std::string, std::string, std::less<>>;
+
+struct parsed_line {
+  std::string raw;
+  record_t fields;
+};
+
+/// Parses one line written by aoc::harness::format_json.
+/// Values come back unquoted and unescaped, numbers and booleans as written.
+std::optional<record_t> parse_record(std::string_view line) {
+  line = aoc::trim(line);
+  if (!line.starts_with('{') || !line.ends_with('}')) {
+    return {};
+  }
+  line = line.substr(1, line.size() - 2);
+
+  std::size_t pos = 0;
+  const auto parse_string = [&]() -> std::optional<std::string> {
+    if ((pos >= line.size()) || (line[pos] != '"')) {
+      return {};
+    }
+    ++pos;
+    auto value = std::string{};
+    while ((pos < line.size()) && (line[pos] != '"')) {
+      char c = line[pos++];
+      if ((c == '\\') && (pos < line.size())) {
+        const char escaped = line[pos++];
+        switch (escaped) {
+          case 'n':
+            c = '\n';
+            break;
+          case 'r':
+            c = '\r';
+            break;
+          case 't':
+            c = '\t';
+            break;
+          case 'u':
+            // The harness only escapes control characters this way
+            c = static_cast<char>(aoc::to_number<int>(line.substr(pos, 4), 16));
+            pos += 4;
+            break;
+          default:
+            c = escaped;
+        }
+      }
+      value += c;
+    }
+    if (pos >= line.size()) {
+      return {};
+    }
+    ++pos;
+    return value;
+  };
+
+  auto record = record_t{};
+  while (pos < line.size()) {
+    auto key = parse_string();
+    if (!key || (pos >= line.size()) || (line[pos] != ':')) {
+      return {};
+    }
+    ++pos;
+    auto value = std::optional<std::string>{};
+    if ((pos < line.size()) && (line[pos] == '"')) {
+      value = parse_string();
+    } else {
+      const auto end = std::min(line.find(',', pos), line.size());
+      value = std::string{line.substr(pos, end - pos)};
+      pos = end;
+    }
+    if (!value) {
+      return {};
+    }
+    record.emplace(std::move(*key), std::move(*value));
+    if ((pos < line.size()) && (line[pos] == ',')) {
+      ++pos;
+    }
+  }
+  return record;
+}
+
+std::string field(const record_t& record, std::string_view name) {
+  const auto it = record.find(name);
+  return (it != record.end()) ? it->second : std::string{};
+}
+
+std::int64_t number_field(const record_t& record, std::string_view name) {
+  const auto value = field(record, name);
+  return value.empty() ? 0 : aoc::to_number<std::int64_t>(value);
+}
+
+std::vector<std::filesystem::path> collect_inputs(
+    std::span<const std::string_view> arguments) {
+  auto inputs = std::vector<std::filesystem::path>{};
+  for (const auto argument : arguments) {
+    const auto path = std::filesystem::path{argument};
+    if (std::filesystem::is_directory(path)) {
+      for (const auto& entry : std::filesystem::directory_iterator{path}) {
+        if (entry.path().extension() == ".jsonl") {
+          inputs.push_back(entry.path());
+        }
+      }
+    } else {
+      inputs.push_back(path);
+    }
+  }
+  std::ranges::sort(inputs);
+  return inputs;
+}
+
+struct test_summary {
+  int year = 0;
+  std::string day;
+  int checks = 0;
+  int failed = 0;
+  std::int64_t median_ns = 0;
+};
+
+std::vector<test_summary> summarize(std::span<const parsed_line> lines) {
+  auto tests = std::map<std::pair<int, std::string>, test_summary>{};
+  for (const auto& line : lines) {
+    const auto year = static_cast<int>(number_field(line.fields, "year"));
+    auto day = field(line.fields, "day");
+    auto& summary = tests[{year, day}];
+    summary.year = year;
+    summary.day = std::move(day);
+    ++summary.checks;
+    summary.failed += (field(line.fields, "passed") != "true");
+    summary.median_ns += number_field(line.fields, "median_ns");
+  }
+  return tests | std::views::values | aoc::collect_vec<test_summary>();
+}
+
+void write_json(std::ofstream& out, std::span<const parsed_line> lines,
+                std::span<const test_summary> tests) {
+  const auto checks = aoc::ranges::accumulate(
+      tests | std::views::transform(&test_summary::checks), 0);
+  const auto failed = aoc::ranges::accumulate(
+      tests | std::views::transform(&test_summary::failed), 0);
+  const auto median_ns = aoc::ranges::accumulate(
+      tests | std::views::transform(&test_summary::median_ns), std::int64_t{0});
+  std::println(out,
+               R"({{"tests":{},"checks":{},"failed":{},"median_ns":{},)",
+               tests.size(), checks, failed, median_ns);
+  std::println(out, R"("per_test":[)");
+  for (bool first = true; const auto& test : tests) {
+    std::println(
+        out, R"({}{{"year":{},"day":"{}","checks":{},"failed":{},)"
+             R"("median_ns":{}}})",
+        first ? "" : ",", test.year, aoc::harness::json_escape(test.day),
+        test.checks, test.failed, test.median_ns);
+    first = false;
+  }
+  std::println(out, R"(],"records":[)");
+  for (bool first = true; const auto& line : lines) {
+    std::println(out, "{}{}", first ? "" : ",", line.raw);
+    first = false;
+  }
+  std::println(out, "]}}");
+}
+
+void write_csv(std::ofstream& out, std::span<const parsed_line> lines) {
+  std::println(out, "{}", aoc::harness::csv_header);
+  const auto columns = aoc::split(aoc::harness::csv_header, ',');
+  for (const auto& line : lines) {
+    for (bool first = true; const auto column : columns) {
+      std::print(out, "{}{}", first ? "" : ",",
+                 aoc::harness::csv_escape(field(line.fields, column)));
+      first = false;
+    }
+    out << '\n';
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc < 3) {
+    std::println("Usage: {} <report.json | report.csv> <file or directory>...",
+                 argv[0]);
+    return 1;
+  }
+  const auto arguments = std::vector<std::string_view>(argv + 1, argv + argc);
+  const auto output_path = std::filesystem::path{arguments[0]};
+
+  auto lines = std::vector<parsed_line>{};
+  for (const auto& input :
+       collect_inputs(std::span{arguments}.subspan(1))) {
+    auto file = std::ifstream{input};
+    for (auto raw = std::string{}; std::getline(file, raw);) {
+      if (aoc::trim(raw).empty()) {
+        continue;
+      }
+      auto fields = parse_record(raw);
+      if (!fields) {
+        std::println("Skipping malformed record in {}: {}", input.string(),
+                     raw);
+        continue;
+      }
+      lines.push_back({std::move(raw), std::move(*fields)});
+    }
+  }
+  const auto tests = summarize(lines);
+
+  auto out = std::ofstream{output_path};
+  if (!out) {
+    std::println("Cannot write {}", output_path.string());
+    return 1;
+  }
+  if (output_path.extension() == ".csv") {
+    write_csv(out, lines);
+  } else {
+    write_json(out, lines, tests);
+  }
+
+  // Slowest first, that is what anyone reading this is looking for
+  auto by_time = tests;
+  std::ranges::sort(by_time, std::ranges::greater{}, &test_summary::median_ns);
+  for (const auto& test : by_time) {
+    std::println("  {}_{:<6} {:>3} checks {:>3} failed {:>12.3f} ms", test.year,
+                 test.day, test.checks, test.failed,
+                 static_cast<double>(test.median_ns) / 1'000'000.0);
+  }
+  std::println("{} tests, {} records written to {}", tests.size(),
+               lines.size(), output_path.string());
+  return 0;
+}
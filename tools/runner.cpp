@@ -0,0 +1,431 @@
+// Runs any subset of the days linked into it in a single process,
+// so a whole year pays for process startup once
+// and its wall time is one number. See runner.h for how days get in.
+//
+// Usage: aoc_runner [-j | -jN] [--timings=file] [--list] [year | year/day]...
+//
+// Without a selection every linked day runs.
+// They run one after the other unless -j asks for N at a time,
+// or as many as there are hardware threads, see run_parallel.
+// How long each day took is remembered in the timings file,
+// aoc_runner.timings in the working directory unless told otherwise.
+
+#include "../common/common.h"
+#include "runner.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define AOC_RUNNER_FORK
+#endif
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#endif
+
+namespace {
+
+using aoc::runner::day_entry;
+
+std::string day_name(const day_entry& day) {
+  return std::format("{}/{}", day.year, day.day);
+}
+
+bool is_selected(const day_entry& day,
+                 std::span<const std::string_view> selection) {
+  if (selection.empty()) {
+    return true;
+  }
+  const auto year = std::to_string(day.year);
+  const auto name = day_name(day);
+  return std::ranges::any_of(selection, [&](std::string_view selector) {
+    return (selector == year) || (selector == name);
+  });
+}
+
+enum class outcome { passed, failed, skipped };
+
+struct day_result {
+  const day_entry* day = nullptr;
+  outcome result = outcome::skipped;
+  double milliseconds = 0;
+};
+
+constexpr std::string_view outcome_name(outcome result) {
+  switch (result) {
+    case outcome::passed:
+      return "OK";
+    case outcome::failed:
+      return "FAIL";
+    case outcome::skipped:
+      return "SKIP";
+  }
+  AOC_UNREACHABLE("Unknown outcome");
+}
+
+outcome run_day_main(const day_entry& day) {
+  std::filesystem::current_path(day.input_dir);
+  aoc::harness::begin_test();
+  try {
+    return (day.main() == 0) ? outcome::passed : outcome::failed;
+  } catch (const aoc::incomplete_test&) {
+    return outcome::skipped;
+  }
+}
+
+std::vector<day_result> run_serial(std::span<const day_entry> days) {
+  auto results = std::vector<day_result>{};
+  for (const auto& day : days) {
+    std::println("=== {} ===", day_name(day));
+    auto day_timer = aoc::timer{};
+    day_timer.start();
+    const auto result = run_day_main(day);
+    day_timer.stop();
+    aoc::flush();
+    results.push_back({&day, result, day_timer.milliseconds()});
+  }
+  return results;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Timings
+
+// Milliseconds per day name
+using timings_t = std::map<std::string, double, std::less<>>;
+
+timings_t load_timings(const std::filesystem::path& path) {
+  auto timings = timings_t{};
+  auto file = std::ifstream{path};
+  auto name = std::string{};
+  double milliseconds = 0;
+  while (file >> name >> milliseconds) {
+    timings[name] = milliseconds;
+  }
+  return timings;
+}
+
+void save_timings(const std::filesystem::path& path, const timings_t& timings) {
+  auto file = std::ofstream{path};
+  if (!file) {
+    std::println("Cannot write timings to {}", path.string());
+    return;
+  }
+  for (const auto& [name, milliseconds] : timings) {
+    std::println(file, "{} {:.3f}", name, milliseconds);
+  }
+}
+
+/// What the day took last time, infinity for one never timed
+double remembered_ms(const day_entry& day, const timings_t& timings) {
+  const auto it = timings.find(day_name(day));
+  return (it != timings.end()) ? it->second
+                               : std::numeric_limits<double>::infinity();
+}
+
+/// Longest first, days never timed before ahead of all of them -
+/// they are as likely as any to be the long ones
+std::vector<std::size_t> longest_first(std::span<const day_entry> days,
+                                       const timings_t& timings) {
+  auto order = std::vector<std::size_t>(days.size());
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::ranges::stable_sort(order, std::ranges::greater{}, [&](std::size_t i) {
+    return remembered_ms(days[i], timings);
+  });
+  return order;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Parallel
+
+#ifdef AOC_RUNNER_FORK
+
+constexpr int exit_code(outcome result) {
+  switch (result) {
+    case outcome::passed:
+      return 0;
+    case outcome::failed:
+      return 1;
+    case outcome::skipped:
+      return AOC_SKIP_RETURN_CODE;
+  }
+  AOC_UNREACHABLE("Unknown outcome");
+}
+
+struct running_day {
+  std::size_t index;
+  pid_t pid;
+  int output_fd;
+  std::string output;
+  aoc::timer timer;
+};
+
+running_day launch(const day_entry& day, std::size_t index, unsigned threads) {
+  int pipe_fds[2];
+  if (::pipe(pipe_fds) != 0) {
+    throw std::system_error{errno, std::generic_category(), "pipe"};
+  }
+  // Anything still buffered would be written twice, once by each process
+  aoc::flush();
+  std::fflush(nullptr);
+
+  auto day_timer = aoc::timer{};
+  day_timer.start();
+  const pid_t pid = ::fork();
+  if (pid < 0) {
+    throw std::system_error{errno, std::generic_category(), "fork"};
+  }
+  if (pid == 0) {
+    ::close(pipe_fds[0]);
+    ::dup2(pipe_fds[1], STDOUT_FILENO);
+    ::dup2(pipe_fds[1], STDERR_FILENO);
+    ::close(pipe_fds[1]);
+    aoc::worker_thread_budget() = threads;
+    const auto result = run_day_main(day);
+    aoc::flush();
+    std::fflush(nullptr);
+    // Skips the destructors of everything the parent set up
+    std::_Exit(exit_code(result));
+  }
+  ::close(pipe_fds[1]);
+  return {index, pid, pipe_fds[0], {}, day_timer};
+}
+
+outcome wait_for(const running_day& running) {
+  int status = 0;
+  while (::waitpid(running.pid, &status, 0) < 0) {
+    if (errno != EINTR) {
+      return outcome::failed;
+    }
+  }
+  if (!WIFEXITED(status)) {
+    std::println("  Killed by signal {}", WTERMSIG(status));
+    return outcome::failed;
+  }
+  switch (WEXITSTATUS(status)) {
+    case 0:
+      return outcome::passed;
+    case AOC_SKIP_RETURN_CODE:
+      return outcome::skipped;
+    default:
+      return outcome::failed;
+  }
+}
+
+/**
+ * Runs the days side by side, each in a process forked off this one.
+ *
+ * Threads would not do: the days open their inputs relative to the working
+ * directory, print straight to stdout and keep the harness state in globals,
+ * all of which belong to the process.
+ * A fork still skips everything starting a fresh process would redo -
+ * loading, relocation, static initialization.
+ *
+ * Days are started longest first, so the long ones do not start last
+ * and trail behind everything else.
+ *
+ * A day's share of the hardware threads is fixed once it is forked,
+ * so it is weighed up front by how long the day took last time:
+ * it gets the part of the threads that it is of the timed work left,
+ * the days still running included.
+ * The long days, the ones parallelizing internally, get most of them
+ * instead of one thread each, and end about when the short ones do.
+ * A day never timed could be anything,
+ * it gets an even split between the days side by side.
+ * num_worker_threads hands the share to the day.
+ *
+ * Each day's output is held back and printed in one piece once it is done.
+ */
+std::vector<day_result> run_parallel(std::span<const day_entry> days,
+                                     const timings_t& timings, unsigned jobs) {
+  const auto threads = aoc::num_worker_threads();
+  const auto order = longest_first(days, timings);
+  const auto expected_ms = [&](std::size_t index) {
+    return remembered_ms(days[index], timings);
+  };
+  double work_left_ms = 0;
+  for (const auto index : order) {
+    if (std::isfinite(expected_ms(index))) {
+      work_left_ms += expected_ms(index);
+    }
+  }
+
+  auto results = std::vector<day_result>(days.size());
+  auto running = std::vector<running_day>{};
+  std::size_t next = 0;
+  const auto thread_share = [&](std::size_t index) {
+    const auto day_ms = expected_ms(index);
+    if (!std::isfinite(day_ms) || (work_left_ms <= 0)) {
+      const auto side_by_side =
+          std::min<std::size_t>(jobs, order.size() - next);
+      return std::max(1u, threads / static_cast<unsigned>(side_by_side));
+    }
+    const auto share = std::lround(threads * day_ms / work_left_ms);
+    return std::clamp(static_cast<unsigned>(share), 1u, threads);
+  };
+  while ((next < order.size()) || !running.empty()) {
+    while ((next < order.size()) && (running.size() < jobs)) {
+      const auto index = order[next];
+      running.push_back(launch(days[index], index, thread_share(index)));
+      ++next;
+    }
+
+    auto fds = std::vector<pollfd>{};
+    for (const auto& day : running) {
+      fds.push_back({.fd = day.output_fd, .events = POLLIN, .revents = 0});
+    }
+    if (::poll(fds.data(), fds.size(), -1) < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::system_error{errno, std::generic_category(), "poll"};
+    }
+
+    for (std::size_t i = 0; i < running.size(); ++i) {
+      if (fds[i].revents == 0) {
+        continue;
+      }
+      auto& day = running[i];
+      char buffer[4096];
+      const auto num_read = ::read(day.output_fd, buffer, sizeof(buffer));
+      if (num_read > 0) {
+        day.output.append(buffer, static_cast<std::size_t>(num_read));
+        continue;
+      }
+      if ((num_read < 0) && (errno == EINTR)) {
+        continue;
+      }
+
+      // End of output, the day is done
+      ::close(day.output_fd);
+      day.output_fd = -1;
+      const auto& entry = days[day.index];
+      std::print("=== {} ===\n{}", day_name(entry), day.output);
+      const auto result = wait_for(day);
+      day.timer.stop();
+      aoc::flush();
+      results[day.index] = {&entry, result, day.timer.milliseconds()};
+      if (std::isfinite(expected_ms(day.index))) {
+        work_left_ms -= expected_ms(day.index);
+      }
+    }
+    std::erase_if(running,
+                  [](const running_day& day) { return day.output_fd < 0; });
+  }
+  return results;
+}
+
+#endif // AOC_RUNNER_FORK
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  auto selection = std::vector<std::string_view>{};
+  bool list_only = false;
+  unsigned jobs = 1;
+  auto timings_path = std::filesystem::path{"aoc_runner.timings"};
+  for (const auto argument : std::span{argv + 1, argv + argc}) {
+    const auto arg = std::string_view{argument};
+    if (arg == "--list") {
+      list_only = true;
+    } else if (arg == "-j") {
+      jobs = aoc::num_worker_threads();
+    } else if (arg.starts_with("-j")) {
+      const auto count = arg.substr(2);
+      const auto count_end = count.data() + count.size();
+      const auto [end, ec] = std::from_chars(count.data(), count_end, jobs);
+      if ((ec != std::errc{}) || (end != count_end)) {
+        std::println("Usage: aoc_runner [-j | -jN] [--timings=file] [--list] "
+                     "[year | year/day]...");
+        return 1;
+      }
+      jobs = std::max(jobs, 1u);
+    } else if (arg.starts_with("--timings=")) {
+      timings_path = arg.substr(std::string_view{"--timings="}.size());
+    } else {
+      selection.push_back(arg);
+    }
+  }
+
+  auto days = aoc::runner::registry();
+  std::ranges::sort(days, {}, [](const day_entry& day) {
+    return std::pair{day.year, day.day};
+  });
+  std::erase_if(days, [&](const day_entry& day) {
+    return !is_selected(day, selection);
+  });
+  if (days.empty()) {
+    std::println("Nothing to run, see --list for what is linked in");
+    return 1;
+  }
+  if (list_only) {
+    for (const auto& day : days) {
+      std::println("{}", day_name(day));
+    }
+    return 0;
+  }
+
+  // Incomplete days throw instead of ending the whole run
+  aoc::exit_on_incomplete() = false;
+  // Resolves the relative paths before the first change of directory
+  [[maybe_unused]] const auto& options = aoc::harness::get_options();
+  timings_path = std::filesystem::absolute(timings_path);
+  const auto original_dir = std::filesystem::current_path();
+  auto timings = load_timings(timings_path);
+
+  auto total_timer = aoc::timer{};
+  total_timer.start();
+  auto results = std::vector<day_result>{};
+#ifdef AOC_RUNNER_FORK
+  if (jobs > 1) {
+    results = run_parallel(days, timings, jobs);
+  } else {
+    results = run_serial(days);
+  }
+#else
+  if (jobs > 1) {
+    std::println("Running one day at a time, -j needs fork");
+  }
+  results = run_serial(days);
+#endif
+  total_timer.stop();
+  std::filesystem::current_path(original_dir);
+
+  std::println("");
+  for (const auto& result : results) {
+    std::println("  {:<12} {:<4} {:>12.3f} ms", day_name(*result.day),
+                 outcome_name(result.result), result.milliseconds);
+    timings[day_name(*result.day)] = result.milliseconds;
+  }
+  save_timings(timings_path, timings);
+
+  const auto count = [&](outcome wanted) {
+    return std::ranges::count(results, wanted, &day_result::result);
+  };
+  std::println("{} days on {} jobs: {} passed, {} failed, {} skipped, "
+               "startup {:.3f} ms, total {:.3f} ms",
+               results.size(), jobs, count(outcome::passed),
+               count(outcome::failed), count(outcome::skipped),
+               aoc::harness::process_started.startup_ms,
+               total_timer.milliseconds());
+  return (count(outcome::failed) > 0) ? 1 : 0;
+}
@@ -0,0 +1,42 @@
+#ifndef AOC_RUNNER_H
+#define AOC_RUNNER_H
+
+// The registry aoc_runner picks its days from.
+//
+// Every day linked into the runner is compiled a second time
+// from runner_day.cpp.in, wrapped in a namespace of its own,
+// and registers its main here before the runner's main starts.
+// A day is the smallest unit that can be run:
+// its parts share the parsed input inside main.
+
+#include "../common/compiler.h"
+
+#ifndef AOC_IMPORT_STD
+#include <string_view>
+#include <vector>
+#endif
+
+namespace aoc::runner {
+
+struct day_entry {
+  int year;
+  std::string_view day;
+  // The day opens its inputs by relative path, so it is run from here
+  std::string_view input_dir;
+  int (*main)();
+};
+
+inline std::vector<day_entry>& registry() {
+  static auto days = std::vector<day_entry>{};
+  return days;
+}
+
+struct registration {
+  explicit registration(const day_entry& entry) {
+    registry().push_back(entry);
+  }
+};
+
+} // namespace aoc::runner
+
+#endif // AOC_RUNNER_H
@@ -0,0 +1,176 @@
+// Runs a day on generated inputs many times the size of the real one
+// and reports how its time grows with the size,
+// to catch solutions that only get away with their complexity
+// because the puzzle inputs are small.
+//
+// Usage: aoc_scaled [--scales=1,10,100,1000] [--seed=N] [--budget=seconds]
+//                   [--memory-limit=MiB] <year/day> <executable>
+//        aoc_scaled --list
+//
+// The inputs come from the day's generator in scaled/,
+// written to scaled/ in the working directory and reused by later runs
+// with the same seed. The day solves them through AOC_SCALED_INPUT,
+// see aoc::harness::scaled_input.
+//
+// Every scale runs once, as a whole process.
+// A run out of time or memory ends the series, larger ones would be too.
+//
+// POSIX only, like everything else built on process.h.
+
+#include "../common/common.h"
+#include "process.h"
+#include "scaled/generator.h"
+
+#ifndef AOC_IMPORT_STD
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <optional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#endif
+
+namespace {
+
+using aoc::tools::outcome;
+
+const aoc::scaled::generator* find_generator(std::string_view name) {
+  const auto& generators = aoc::scaled::registry();
+  const auto it = std::ranges::find_if(generators, [&](const auto& entry) {
+    return std::format("{}/{}", entry.year, entry.day) == name;
+  });
+  return (it != generators.end()) ? &*it : nullptr;
+}
+
+std::filesystem::path generate_input(const aoc::scaled::generator& generator,
+                                     std::size_t scale, std::uint64_t seed) {
+  auto path = std::filesystem::absolute(
+      std::filesystem::path{"scaled"} /
+      std::format("{}_{}_x{}_seed{}.input", generator.year, generator.day,
+                  scale, seed));
+  if (std::filesystem::exists(path)) {
+    return path;
+  }
+  std::filesystem::create_directories(path.parent_path());
+  // Written aside and renamed, an interrupted run leaves no partial input
+  auto partial = path;
+  partial += ".partial";
+  {
+    auto file = std::ofstream{partial, std::ios::binary};
+    auto rng = aoc::scaled::random_engine{seed};
+    generator.write(file, generator.base_size * scale, rng);
+  }
+  std::filesystem::rename(partial, path);
+  return path;
+}
+
+std::vector<std::size_t> parse_scales(std::string_view list) {
+  auto scales = std::vector<std::size_t>{};
+  for (const auto scale : aoc::split_to_vec(list, ",")) {
+    scales.push_back(std::max(aoc::to_number<std::size_t>(scale), 1uz));
+  }
+  std::ranges::sort(scales);
+  return scales;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  auto scales = std::vector<std::size_t>{1, 10, 100, 1000};
+  std::uint64_t seed = 1;
+  auto limits = aoc::tools::process_limits{.seconds = 10, .memory_mib = 4096};
+  auto positional = std::vector<std::string_view>{};
+  for (const auto argument : std::span{argv + 1, argv + argc}) {
+    const auto arg = std::string_view{argument};
+    const auto value_of = [&](std::string_view option) {
+      return arg.substr(option.size());
+    };
+    if (arg == "--list") {
+      for (const auto& generator : aoc::scaled::registry()) {
+        std::println("{}/{}", generator.year, generator.day);
+      }
+      return 0;
+    } else if (arg.starts_with("--scales=")) {
+      scales = parse_scales(value_of("--scales="));
+    } else if (arg.starts_with("--seed=")) {
+      seed = aoc::to_number<std::uint64_t>(value_of("--seed="));
+    } else if (arg.starts_with("--budget=")) {
+      limits.seconds = aoc::to_number<unsigned>(value_of("--budget="));
+    } else if (arg.starts_with("--memory-limit=")) {
+      limits.memory_mib =
+          aoc::to_number<std::uint64_t>(value_of("--memory-limit="));
+    } else {
+      positional.push_back(arg);
+    }
+  }
+  if (positional.size() != 2) {
+    std::println("Usage: {} [--scales=1,10,100,1000] [--seed=N] "
+                 "[--budget=seconds] [--memory-limit=MiB] "
+                 "<year/day> <executable>",
+                 argv[0]);
+    return 1;
+  }
+  const auto* generator = find_generator(positional[0]);
+  if (generator == nullptr) {
+    std::println("No generator for {}, see --list", positional[0]);
+    return 1;
+  }
+  const auto executable = std::filesystem::absolute(positional[1]);
+  const auto day = aoc::tools::program{
+      .executable = executable.string(),
+      .working_dir = executable.parent_path().string(),
+  };
+
+  std::println("{} on generated inputs, seed {}, {} s and {} MiB per run",
+               positional[0], seed, limits.seconds, limits.memory_mib);
+  std::println("  {:>7} {:>12} {:>12} {:>10} {:>9}", "scale", generator->unit,
+               "time ms", "peak MiB", "growth");
+  bool any_failed = false;
+  // Size and time of the last run that finished
+  auto previous = std::optional<std::pair<double, double>>{};
+  for (const auto scale : scales) {
+    const auto input = generate_input(*generator, scale, seed);
+    const auto n = generator->base_size * scale;
+    const auto environment = std::array{
+        std::pair<const char*, std::string>{"AOC_SCALED_INPUT", input.string()},
+    };
+    aoc::flush();
+    auto run_timer = aoc::timer{};
+    run_timer.start();
+    const auto run = aoc::tools::run_process(day, environment, limits);
+    run_timer.stop();
+
+    const auto label = std::format("x{}", scale);
+    if (run.result != outcome::passed) {
+      const auto why = (run.result == outcome::timed_out)
+                           ? std::format("over {} s", limits.seconds)
+                           : std::string{"failed, out of memory?"};
+      std::println("  {:>7} {:>12} {:>12}", label, n, why);
+      any_failed = any_failed || (run.result != outcome::timed_out);
+      break;
+    }
+
+    const auto milliseconds = run_timer.milliseconds();
+    // The exponent k of n^k fitting the step from the previous scale
+    auto growth = std::string{"-"};
+    if (previous && (previous->second > 0)) {
+      const auto exponent = std::log(milliseconds / previous->second) /
+                            std::log(static_cast<double>(n) / previous->first);
+      growth = std::format("n^{:.2f}", exponent);
+    }
+    std::println("  {:>7} {:>12} {:>12.3f} {:>10.1f} {:>9}", label, n,
+                 milliseconds, static_cast<double>(run.peak_rss_kb) / 1024.0,
+                 growth);
+    previous = std::pair{static_cast<double>(n), milliseconds};
+  }
+  return any_failed ? 1 : 0;
+}
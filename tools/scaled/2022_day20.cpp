@@ -0,0 +1,36 @@
+// Numbers to mix, exactly one of them zero.
+// The real input has 5000 of them between -10000 and 10000,
+// with duplicates.
+
+#include "generator.h"
+
+#ifndef AOC_IMPORT_STD
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#endif
+
+namespace {
+
+void write(std::ostream& out, std::size_t n,
+           aoc::scaled::random_engine& rng) {
+  const auto zero_at =
+      static_cast<std::size_t>(aoc::scaled::uniform(rng, 0, n - 1));
+  for (std::size_t i = 0; i < n; ++i) {
+    auto number = std::int64_t{0};
+    while ((number == 0) && (i != zero_at)) {
+      number = aoc::scaled::uniform(rng, -10000, 10000);
+    }
+    out << number << '\n';
+  }
+}
+
+const aoc::scaled::registration registered{{
+    .year = 2022,
+    .day = "day20",
+    .unit = "numbers",
+    .base_size = 5000,
+    .write = &write,
+}};
+
+} // namespace
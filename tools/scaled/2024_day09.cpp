@@ -0,0 +1,33 @@
+// A single line disk map, alternating file and free space lengths.
+// The real input is 19999 digits long, starting and ending with a file.
+// Files are never empty, free space can be.
+
+#include "generator.h"
+
+#ifndef AOC_IMPORT_STD
+#include <cstddef>
+#include <ostream>
+#endif
+
+namespace {
+
+void write(std::ostream& out, std::size_t n,
+           aoc::scaled::random_engine& rng) {
+  // Odd, so it ends with a file like the real one
+  n |= 1;
+  for (std::size_t i = 0; i < n; ++i) {
+    const bool file = (i % 2) == 0;
+    out << static_cast<char>('0' + aoc::scaled::uniform(rng, file ? 1 : 0, 9));
+  }
+  out << '\n';
+}
+
+const aoc::scaled::registration registered{{
+    .year = 2024,
+    .day = "day09",
+    .unit = "digits",
+    .base_size = 19999,
+    .write = &write,
+}};
+
+} // namespace
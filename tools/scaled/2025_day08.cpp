@@ -0,0 +1,30 @@
+// Junction boxes, one x,y,z position per line.
+// The real input has 1000 of them, coordinates below 100000.
+
+#include "generator.h"
+
+#ifndef AOC_IMPORT_STD
+#include <cstddef>
+#include <ostream>
+#endif
+
+namespace {
+
+void write(std::ostream& out, std::size_t n,
+           aoc::scaled::random_engine& rng) {
+  for (std::size_t i = 0; i < n; ++i) {
+    out << aoc::scaled::uniform(rng, 0, 99999) << ','
+        << aoc::scaled::uniform(rng, 0, 99999) << ','
+        << aoc::scaled::uniform(rng, 0, 99999) << '\n';
+  }
+}
+
+const aoc::scaled::registration registered{{
+    .year = 2025,
+    .day = "day08",
+    .unit = "boxes",
+    .base_size = 1000,
+    .write = &write,
+}};
+
+} // namespace
@@ -0,0 +1,63 @@
+#ifndef AOC_SCALED_GENERATOR_H
+#define AOC_SCALED_GENERATOR_H
+
+// The registry aoc_scaled picks its input generators from.
+//
+// One generator per day, in tools/scaled/<year>_<day>.cpp,
+// registering itself here before main starts, like the days of aoc_runner.
+// A generator writes an input of n elements of whatever the day's input
+// is a list of, valid for the day's parser and solvable by its solution.
+// Scale 1 is the size of the real puzzle input.
+
+#include "../../common/compiler.h"
+
+#ifndef AOC_IMPORT_STD
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string_view>
+#include <vector>
+#endif
+
+namespace aoc::scaled {
+
+using random_engine = std::mt19937_64;
+
+/**
+ * Uniform in [min, max].
+ *
+ * The standard distributions differ between standard libraries,
+ * the engine does not, so this keeps the inputs of a seed
+ * the same everywhere. The modulo bias is far below anything measured.
+ */
+inline std::int64_t uniform(random_engine& rng, std::int64_t min,
+                            std::int64_t max) {
+  const auto range = static_cast<std::uint64_t>(max - min) + 1;
+  return min + static_cast<std::int64_t>(rng() % range);
+}
+
+struct generator {
+  int year;
+  std::string_view day;
+  // What n counts, for the report
+  std::string_view unit;
+  // n at scale 1
+  std::size_t base_size;
+  void (*write)(std::ostream& out, std::size_t n, random_engine& rng);
+};
+
+inline std::vector<generator>& registry() {
+  static auto generators = std::vector<generator>{};
+  return generators;
+}
+
+struct registration {
+  explicit registration(const generator& entry) {
+    registry().push_back(entry);
+  }
+};
+
+} // namespace aoc::scaled
+
+#endif // AOC_SCALED_GENERATOR_H